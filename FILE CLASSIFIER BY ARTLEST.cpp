@@ -8,138 +8,426 @@
  * and compilation environments.
  */
 
+#include "artlest_file_sorter.h"  // Categories, classifier, user rules and move executor
+
 #include <iostream>     // Standard input/output stream operations
 #include <string>       // String manipulation and processing utilities
+#include <string_view>  // Non-owning string references for allocation-free parsing
 #include <vector>       // Dynamic array container for file storage
-#include <map>          // Associative container for extension mapping
 #include <algorithm>    // Standard algorithms for data processing
 #include <iomanip>      // Input/output manipulation utilities
-
-// File classification data structure definition
-struct file_classification_entry {
-    std::string filename_identifier;          // Original filename string
-    std::string extension_category;           // File extension classification
-    std::string destination_directory;        // Target directory assignment
-    int processing_priority;                  // Sorting priority level
-};
-
+#include <deque>        // Double-ended queues for work-stealing directory scheduling
+#include <thread>       // Worker thread management for parallel traversal
+#include <mutex>        // Mutual exclusion primitives for shared queues
+#include <atomic>       // Lock-free counters for traversal termination detection
+#include <chrono>       // Time utilities for idle worker back-off
+#include <functional>   // Callback wrappers for discovery notifications
+#include <filesystem>   // Portable directory enumeration facilities
+#include <cstdlib>      // Numeric conversion for command line options
+#include <cstdint>      // Fixed-width integer types for queue sequencing
+#include <memory>       // Owning pointers for ring buffer storage
+#include <cstring>      // Raw byte copies for packed extension keys
+#include <cerrno>       // Error codes reported by file operations
+#include <fstream>      // Persistent incremental index storage
+#include <unordered_map>  // Incremental index lookup by directory path
+#include <unordered_set>  // Excluded subtrees, changed files
+#include <cstdio>       // Unformatted bulk writes for TSV results
+#include <condition_variable>  // Prompt shutdown of the progress reporter thread
+#include <cctype>       // Case conversion of synthetic names
+#include <sstream>      // Benchmark JSON assembly
+#include <cmath>        // Zipf weights for synthetic datasets
+#include <new>          // Allocation hooks of instrumented builds
+#if defined(ARTLEST_POSIX_FILE_OPERATIONS)
+#include <fcntl.h>      // Directory descriptors and openat flags
+#include <unistd.h>     // Descriptor management and terminal detection
+#include <sys/stat.h>   // File metadata for the walker, index and move plans
+#include <sys/mman.h>   // Memory-mapped result files
+#include <signal.h>     // SIGUSR1 instrumentation reports
+#if defined(__linux__)
+#include <sys/sysmacros.h>  // makedev for statx device numbers
+#include <sys/inotify.h>   // Source tree change notifications of --watch
+#include <poll.h>          // Event coalescing timeouts of --watch
+#endif
+#endif
+#if defined(_WIN32)
+#include <io.h>         // _isatty for progress terminal detection
+#endif
+#if defined(__SSE2__) || defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>  // SSE2/AVX2 intrinsics for the batch extension kernel
+#endif
 // Global configuration constants for system operation
 const int MAXIMUM_PROCESSING_ITERATIONS = 50;    // Processing limit for online environments
-const int PROGRESS_UPDATE_INTERVAL = 10;         // Progress reporting frequency
+const int PROGRESS_UPDATE_INTERVAL = 10;         // Progress redraws per second (reporter thread rate limit)
 const int CLASSIFICATION_BUFFER_SIZE = 100;      // Maximum file entries in buffer
+const int MAXIMUM_WALKER_THREAD_COUNT = 256;     // Upper bound for directory walker workers
+const int STREAMING_QUEUE_CAPACITY = 256;        // Batches held between streaming pipeline stages
+const long long THROUGHPUT_MINIMUM_SAMPLE_SIZE = 1000000;  // Classifications per throughput measurement
+const int64_t UNVERIFIED_MODIFICATION_TIME = INT64_MIN;  // Directory record that must be listed again
+const size_t TSV_OUTPUT_BUFFER_SIZE = 1 << 20;   // Bytes collected before each TSV write
+const size_t CONTENT_SNIFF_LENGTH = 16;          // Leading bytes read per unclassified file
+const uint64_t DUPLICATE_PARTIAL_HASH_LENGTH = 4096;  // Head and tail bytes hashed by the partial duplicate tier
+const char* const SHARD_MANIFEST_MAGIC = "ARTLSHARD1";       // First line of shard manifests
+const char* const SHARD_REPORT_MAGIC = "ARTLSHARDREPORT1";   // First line of shard reports
+const char* const MOVE_PLAN_MAGIC = "ARTLPLAN1";             // First line of saved move plans
+const uint64_t PLAN_BANDWIDTH_SAMPLE_BYTES = 64ull << 20;    // Source bytes read to estimate copy bandwidth
+const double PLAN_RENAME_COST_SECONDS = 0.00005;             // Estimated cost of one same-device rename
+const size_t EXTERNAL_SORT_RESERVED_BYTES = 64 << 20;        // Memory budget kept for pipeline queues and buffers
+const size_t EXTERNAL_SORT_READ_BUFFER_SIZE = 1 << 20;       // Read buffer per run during a merge pass
+const size_t EXTERNAL_SORT_MAXIMUM_FAN_IN = 256;             // Runs open at once (descriptor limit)
+const size_t EXTERNAL_SORT_EMIT_BATCH_SIZE = 4096;           // Ordered entries handed to the sink per call
+const size_t EXTERNAL_SORT_MINIMUM_MEMORY_MB = 16;           // Smallest accepted --memory-limit
+const size_t RESULT_STORE_CHUNK_SIZE = 4096;                 // Entries rebuilt per chunk when reading the result store
+const int WATCH_COALESCE_MILLISECONDS = 50;                  // Event-free interval that closes a --watch batch
+const int WATCH_MAXIMUM_BATCH_DELAY_MILLISECONDS = 500;      // Longest the oldest event waits while a burst continues
+const int WATCH_IDLE_POLL_MILLISECONDS = 1000;               // Idle wake-up for noticing a stop request
+const size_t WATCH_MAXIMUM_BATCH_FILES = 16384;              // Pending files that close a batch early
+const size_t WATCH_EVENT_BUFFER_SIZE = 64 << 10;             // Bytes read from the inotify descriptor per call
+const double LIVE_STATISTICS_DEFAULT_INTERVAL_SECONDS = 5.0; // Statistics file rewrite period without --stats-interval
+const size_t BENCHMARK_DEFAULT_NAME_COUNT = 1000000;     // Corpus size when --bench-names is absent
+const size_t BENCHMARK_DISTINCT_NAME_LIMIT = 1 << 20;    // Distinct corpus names; larger corpora cycle them
+const int BENCHMARK_DEFAULT_REPETITIONS = 5;             // Timed repetitions per benchmark
+const size_t BENCHMARK_TREE_FILE_COUNT = 16384;          // Empty files in the generated macro benchmark tree
+const int BENCHMARK_TREE_FANOUT = 64;                    // Subdirectories of the generated tree root
+const double SYNTHETIC_DEFAULT_ZIPF_EXPONENT = 1.0;      // Extension popularity skew (0 is uniform)
+const double SYNTHETIC_DEFAULT_MISS_RATE = 0.05;         // Fraction of generated names without a known extension
+const uint64_t SYNTHETIC_DEFAULT_SEED = 13;              // Seed used when --seed is absent
+const size_t SYNTHETIC_DEFAULT_TREE_FILE_COUNT = 100000; // Files written by --generate-tree without --generate
+const size_t SYNTHETIC_MINIMUM_STEM_LENGTH = 4;          // Shortest generated name stem
+const size_t SYNTHETIC_MAXIMUM_STEM_LENGTH = 20;         // Longest generated name stem
+const uint64_t SYNTHETIC_UPPERCASE_PERCENT = 8;          // Known-extension names emitted in upper case
+
+// Destination of per-entry processing results
+enum result_output_format : uint8_t {
+    RESULT_OUTPUT_TABLE,                      // Boxed console table (default)
+    RESULT_OUTPUT_BINARY,                     // Memory-mappable columnar result file
+    RESULT_OUTPUT_TSV                         // Tab-separated lines, one per entry
+};
+
+// Runtime configuration assembled from command line arguments
+struct execution_configuration_parameters {
+    std::string source_directory_path;        // Directory tree to classify (empty selects demo dataset)
+    int walker_thread_count = 0;              // Directory walker workers (0 selects hardware concurrency)
+    int classifier_thread_count = 0;          // Classifier workers (0 selects hardware concurrency)
+    bool streaming_pipeline_enabled = false;  // Report entries as classified instead of collect-then-sort
+    bool throughput_measurement_enabled = false;  // Time the classify stage instead of reporting entries
+    int throughput_repeat_count = 0;          // Passes over the input (0 selects an automatic count)
+    std::string destination_directory_path;   // Root receiving category directories (empty disables moves)
+    bool metadata_collection_enabled = false; // Stat every discovered file (size, inode, mtime)
+    bool io_uring_backend_enabled = false;    // Batch walker statx and executor renames through io_uring
+    std::string incremental_index_path;       // Persistent index of handled files (empty disables incremental runs)
+    result_output_format output_format = RESULT_OUTPUT_TABLE;  // How per-entry results are emitted
+    std::string output_file_path;             // Result file for binary and TSV output
+    bool content_sniffing_enabled = false;    // Classify extension misses by their leading bytes
+    std::string rule_file_path;               // User classification rules (empty uses built-in table only)
+    bool duplicate_detection_enabled = false; // Group identical files and leave redundant copies unmoved
+    int shard_split_count = 0;                // Split --source into this many shard manifests and exit
+    std::string shard_manifest_prefix;        // Path prefix of the manifests written by the split
+    std::string shard_manifest_path;          // Walk only the subtrees listed in this shard manifest
+    std::string shard_label;                  // "index/count" of the loaded shard
+    std::vector<std::string> shard_seed_paths;      // Subtrees walked by the loaded shard
+    std::vector<std::string> shard_excluded_paths;  // Subtrees owned by other shards
+    std::string shard_report_path;            // Save this run's histograms for a later merge
+    std::vector<std::string> merge_report_paths;    // Shard reports combined into one global report
+    bool move_planning_enabled = false;       // Print or save the moves --destination would make, touch nothing
+    std::string move_plan_file_path;          // Save the plan here instead of listing it
+    double plan_bandwidth_megabytes_per_second = 0.0;  // Copy rate for the estimate (0 measures it)
+    std::string replay_plan_path;             // Execute the moves of a saved plan without walking
+    bool adaptive_concurrency_enabled = false;  // Walker and executor concurrency follow observed latency
+    size_t sort_memory_limit_bytes = 0;       // Stream into an external sort under this budget (0 disables)
+    bool sort_by_size_enabled = false;        // External sort puts larger files first within a priority level
+    std::string sort_temporary_directory;     // Run files of the external sort (empty selects the system temp dir)
+    bool quiet_mode_enabled = false;          // No banners, progress or reports; one summary line per run
+    bool watch_mode_enabled = false;          // Keep running and sort files as they arrive (inotify)
+    std::string statistics_file_path;         // Rewrite live counters here in Prometheus text format (empty disables)
+    double statistics_interval_seconds = 0.0; // Period between rewrites (0 selects the default)
+    bool benchmark_mode_enabled = false;      // Run the benchmark suite and print JSON
+    size_t benchmark_name_count = BENCHMARK_DEFAULT_NAME_COUNT;  // Synthetic corpus size for micro benchmarks
+    size_t synthetic_name_count = 0;          // Generated input names (0 selects the fixed demo list)
+    double synthetic_zipf_exponent = SYNTHETIC_DEFAULT_ZIPF_EXPONENT;  // Extension popularity skew
+    double synthetic_miss_rate = SYNTHETIC_DEFAULT_MISS_RATE;          // Fraction of unknown or missing extensions
+    uint64_t synthetic_seed = SYNTHETIC_DEFAULT_SEED;                  // Generator seed for reproducible datasets
+    std::string synthetic_tree_path;          // Write the generated names as an on-disk tree here and exit
+    int synthetic_tree_depth = 2;             // Directory levels below the generated tree root
+    int synthetic_tree_fanout = 8;            // Subdirectories per generated directory
+    bool self_test_requested = false;         // Check built-in algorithms against reference vectors and exit
+    bool usage_requested = false;             // Print usage information and exit
+};
+
+#if defined(ARTLEST_ENABLE_INSTRUMENTATION)
+// Report-side instrumentation state; counters and stage timers are declared in artlest_file_sorter.h
+const char* const INSTRUMENTATION_STAGE_NAMES[INSTRUMENTATION_STAGE_COUNT] = {
+    "walk", "extract", "lookup", "batch extract+lookup", "priority", "move", "report"
+};
+
+std::atomic<uint64_t> instrumented_allocation_count{0};  // operator new calls since start
+std::atomic<uint64_t> instrumented_allocation_bytes{0};  // Bytes requested from operator new since start
+
+// Global allocation hooks: count every operator new in instrumented builds
+void* operator new(std::size_t allocation_size) {
+    instrumented_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    instrumented_allocation_bytes.fetch_add(allocation_size, std::memory_order_relaxed);
+    if (void* allocated_memory = std::malloc(allocation_size != 0 ? allocation_size : 1)) return allocated_memory;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t allocation_size, std::align_val_t allocation_alignment) {
+    instrumented_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    instrumented_allocation_bytes.fetch_add(allocation_size, std::memory_order_relaxed);
+    size_t alignment_bytes = static_cast<size_t>(allocation_alignment);
+    size_t rounded_size = (std::max<size_t>(allocation_size, 1) + alignment_bytes - 1) & ~(alignment_bytes - 1);
+#if defined(_WIN32)
+    void* allocated_memory = _aligned_malloc(rounded_size, alignment_bytes);
+#else
+    void* allocated_memory = std::aligned_alloc(alignment_bytes, rounded_size);
+#endif
+    if (allocated_memory == nullptr) throw std::bad_alloc();
+    return allocated_memory;
+}
+
+// Kept out of line: GCC otherwise pairs the inlined free() with new-expressions and warns
+#if defined(__GNUC__)
+#define ARTLEST_ALLOCATION_HOOK __attribute__((noinline))
+#else
+#define ARTLEST_ALLOCATION_HOOK
+#endif
+ARTLEST_ALLOCATION_HOOK void operator delete(void* allocated_memory) noexcept { std::free(allocated_memory); }
+ARTLEST_ALLOCATION_HOOK void operator delete(void* allocated_memory, std::size_t) noexcept { std::free(allocated_memory); }
+#if defined(_WIN32)
+ARTLEST_ALLOCATION_HOOK void operator delete(void* allocated_memory, std::align_val_t) noexcept { _aligned_free(allocated_memory); }
+ARTLEST_ALLOCATION_HOOK void operator delete(void* allocated_memory, std::size_t, std::align_val_t) noexcept { _aligned_free(allocated_memory); }
+#else
+ARTLEST_ALLOCATION_HOOK void operator delete(void* allocated_memory, std::align_val_t) noexcept { std::free(allocated_memory); }
+ARTLEST_ALLOCATION_HOOK void operator delete(void* allocated_memory, std::size_t, std::align_val_t) noexcept { std::free(allocated_memory); }
+#endif
+
+// Tick and clock readings at startup, used to convert ticks to nanoseconds in reports
+const std::pair<uint64_t, std::chrono::steady_clock::time_point> INSTRUMENTATION_CLOCK_ORIGIN(
+    read_instrumentation_ticks(), std::chrono::steady_clock::now());
+#endif
 
 /**
- * initialize_extension_mapping_database - Establishes file extension classification system
- * This function creates the mapping database that associates file extensions with
- * their corresponding directory categories for professional file organization
+ * packed_filename_classification - Result of classifying one name in a packed buffer
+ * Offsets refer to the packed buffer so results stay small and allocation-free
  */
-void initialize_extension_mapping_database(std::map<std::string, std::string>& extension_mapping_registry) {
-    // Document file extensions mapping to professional categories
-    extension_mapping_registry["txt"] = "DOCUMENTS_REPOSITORY";
-    extension_mapping_registry["doc"] = "DOCUMENTS_REPOSITORY";
-    extension_mapping_registry["docx"] = "DOCUMENTS_REPOSITORY";
-    extension_mapping_registry["pdf"] = "DOCUMENTS_REPOSITORY";
-    extension_mapping_registry["rtf"] = "DOCUMENTS_REPOSITORY";
-    
-    // Multimedia file extensions for media asset management
-    extension_mapping_registry["jpg"] = "MULTIMEDIA_ASSETS";
-    extension_mapping_registry["jpeg"] = "MULTIMEDIA_ASSETS";
-    extension_mapping_registry["png"] = "MULTIMEDIA_ASSETS";
-    extension_mapping_registry["gif"] = "MULTIMEDIA_ASSETS";
-    extension_mapping_registry["bmp"] = "MULTIMEDIA_ASSETS";
-    
-    // Audio file extensions for sound library organization
-    extension_mapping_registry["mp3"] = "AUDIO_LIBRARY";
-    extension_mapping_registry["wav"] = "AUDIO_LIBRARY";
-    extension_mapping_registry["flac"] = "AUDIO_LIBRARY";
-    extension_mapping_registry["aac"] = "AUDIO_LIBRARY";
-    
-    // Video file extensions for video content management
-    extension_mapping_registry["mp4"] = "VIDEO_CONTENT";
-    extension_mapping_registry["avi"] = "VIDEO_CONTENT";
-    extension_mapping_registry["mkv"] = "VIDEO_CONTENT";
-    extension_mapping_registry["mov"] = "VIDEO_CONTENT";
-    
-    // Archive file extensions for compressed data storage
-    extension_mapping_registry["zip"] = "ARCHIVE_STORAGE";
-    extension_mapping_registry["rar"] = "ARCHIVE_STORAGE";
-    extension_mapping_registry["7z"] = "ARCHIVE_STORAGE";
-    extension_mapping_registry["tar"] = "ARCHIVE_STORAGE";
-    
-    // Source code file extensions for development resources
-    extension_mapping_registry["cpp"] = "SOURCE_CODE";
-    extension_mapping_registry["c"] = "SOURCE_CODE";
-    extension_mapping_registry["py"] = "SOURCE_CODE";
-    extension_mapping_registry["java"] = "SOURCE_CODE";
-    extension_mapping_registry["js"] = "SOURCE_CODE";
-    extension_mapping_registry["html"] = "SOURCE_CODE";
+struct packed_filename_classification {
+    uint32_t filename_offset;                 // First byte of the name inside the buffer
+    uint32_t filename_length;                 // Name length excluding the separator
+    classification_category_identifier category_identifier;  // Resolved destination category
+};
+
+// Separator terminating every name in a packed filename buffer (the only byte filenames cannot contain)
+const char PACKED_FILENAME_SEPARATOR = '\0';
+
+/**
+ * append_packed_filename - Appends one name and its separator to a packed buffer
+ */
+inline void append_packed_filename(std::string& packed_filename_buffer, std::string_view current_filename) {
+    packed_filename_buffer.append(current_filename.data(), current_filename.size());
+    packed_filename_buffer.push_back(PACKED_FILENAME_SEPARATOR);
 }
 
 /**
- * extract_file_extension_identifier - Processes filename to extract extension
- * This function implements string parsing algorithms to identify file extensions
- * from complete filename strings for classification purposes
+ * lowercase_packed_ascii - Lowercases eight packed ASCII bytes at once
+ * SWAR range check: bytes in 'A'..'Z' have bit 5 set, every other byte
+ * (including non-ASCII and zero padding) is left untouched
  */
-std::string extract_file_extension_identifier(const std::string& filename_input) {
-    // Locate the last dot character in the filename string
-    size_t extension_delimiter_position = filename_input.find_last_of('.');
-    
-    // Validate that extension delimiter exists within the filename
-    if (extension_delimiter_position != std::string::npos && extension_delimiter_position < filename_input.length() - 1) {
-        // Extract substring from delimiter position to end of string
-        std::string extension_substring = filename_input.substr(extension_delimiter_position + 1);
-        
-        // Convert extension to lowercase for standardized comparison
-        std::transform(extension_substring.begin(), extension_substring.end(), 
-                      extension_substring.begin(), ::tolower);
-        
-        return extension_substring;
+inline uint64_t lowercase_packed_ascii(uint64_t packed_characters) {
+    const uint64_t BYTE_ONES = 0x0101010101010101ull;
+    const uint64_t BYTE_HIGH_BITS = 0x8080808080808080ull;
+    uint64_t low_seven_bits = packed_characters & ~BYTE_HIGH_BITS;
+    uint64_t above_upper_z = low_seven_bits + BYTE_ONES * (0x7F - 'Z');
+    uint64_t at_least_upper_a = low_seven_bits + BYTE_ONES * (0x80 - 'A');
+    uint64_t uppercase_flags = (at_least_upper_a ^ above_upper_z) & ~packed_characters & BYTE_HIGH_BITS;
+    return packed_characters | (uppercase_flags >> 2);
+}
+
+/**
+ * load_packed_extension_key - Packs up to eight extension bytes into a lookup key
+ * Uses the same little-endian byte order as extension_classification_table
+ */
+inline uint64_t load_packed_extension_key(const char* extension_characters, size_t extension_length) {
+    uint64_t packed_key = 0;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    std::memcpy(&packed_key, extension_characters, extension_length);
+#else
+    for (size_t character_index = 0; character_index < extension_length; ++character_index) {
+        packed_key |= static_cast<uint64_t>(static_cast<unsigned char>(extension_characters[character_index])) << (8 * character_index);
     }
-    
-    // Return empty string if no valid extension detected
-    return "";
+#endif
+    return packed_key;
 }
 
 /**
- * determine_classification_category - Maps file extension to directory category
- * This function implements lookup algorithms to determine appropriate storage
- * location based on file extension classification system
+ * count_trailing_zero_bits - Index of the lowest set bit of a non-zero mask
  */
-std::string determine_classification_category(const std::string& file_extension, 
-                                            const std::map<std::string, std::string>& mapping_registry) {
-    // Perform lookup operation in extension mapping registry
-    auto registry_iterator = mapping_registry.find(file_extension);
-    
-    // Validate that extension exists in classification database
-    if (registry_iterator != mapping_registry.end()) {
-        return registry_iterator->second;
+inline int count_trailing_zero_bits(uint64_t bit_mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(bit_mask);
+#else
+    int bit_index = 0;
+    while ((bit_mask & 1) == 0) { bit_mask >>= 1; ++bit_index; }
+    return bit_index;
+#endif
+}
+
+/**
+ * packed_boundary_scanner - Turns separator and dot positions into classifications
+ * Kernels feed it the positions of every separator and dot byte; work is
+ * proportional to the number of such bytes, not the number of characters
+ */
+class packed_boundary_scanner {
+public:
+    packed_boundary_scanner(const char* packed_bytes, const extension_classification_table& mapping_registry,
+                            std::vector<packed_filename_classification>& classification_output)
+        : packed_bytes(packed_bytes), mapping_registry(mapping_registry), classification_output(classification_output) {}
+
+    // Consume one block worth of dot and separator bit masks starting at block_base
+    void consume_boundary_masks(uint64_t dot_mask, uint64_t separator_mask, size_t block_base) {
+        uint64_t event_mask = dot_mask | separator_mask;
+        while (event_mask != 0) {
+            int bit_index = count_trailing_zero_bits(event_mask);
+            size_t byte_position = block_base + bit_index;
+            if ((separator_mask >> bit_index) & 1) {
+                emit_filename_classification(byte_position);
+            } else {
+                last_dot_position = byte_position;
+                dot_seen = true;
+            }
+            event_mask &= event_mask - 1;
+        }
     }
-    
-    // Return default category for unclassified file extensions
-    return "MISCELLANEOUS_FILES";
+
+    // Scalar path for block tails and targets without vector support
+    void consume_scalar_bytes(size_t range_start, size_t range_end) {
+        for (size_t byte_position = range_start; byte_position < range_end; ++byte_position) {
+            char current_character = packed_bytes[byte_position];
+            if (current_character == PACKED_FILENAME_SEPARATOR) {
+                emit_filename_classification(byte_position);
+            } else if (current_character == '.') {
+                last_dot_position = byte_position;
+                dot_seen = true;
+            }
+        }
+    }
+
+private:
+    // Resolve the name ending at separator_position and reset for the next name
+    void emit_filename_classification(size_t separator_position) {
+        classification_category_identifier category_identifier = CATEGORY_MISCELLANEOUS_FILES;
+        if (dot_seen) {
+            size_t extension_length = separator_position - last_dot_position - 1;
+            if (extension_length > 0 && extension_length <= mapping_registry.longest_extension_length()) {
+                uint64_t packed_key = lowercase_packed_ascii(
+                    load_packed_extension_key(packed_bytes + last_dot_position + 1, extension_length));
+                mapping_registry.find_category_by_packed_key(packed_key, category_identifier);
+            }
+        }
+        classification_output.push_back({static_cast<uint32_t>(name_start_position),
+                                         static_cast<uint32_t>(separator_position - name_start_position),
+                                         category_identifier});
+        name_start_position = separator_position + 1;
+        dot_seen = false;
+    }
+
+    const char* packed_bytes;
+    const extension_classification_table& mapping_registry;
+    std::vector<packed_filename_classification>& classification_output;
+    size_t name_start_position = 0;           // First byte of the name being scanned
+    size_t last_dot_position = 0;             // Most recent dot within the current name
+    bool dot_seen = false;                    // Whether the current name contains a dot
+};
+
+// Batch classification kernel signature shared by the scalar and vector variants
+using packed_classification_kernel = void (*)(std::string_view, const extension_classification_table&,
+                                              std::vector<packed_filename_classification>&);
+
+void classify_packed_filenames_scalar(std::string_view packed_filenames, const extension_classification_table& mapping_registry,
+                                      std::vector<packed_filename_classification>& classification_output) {
+    packed_boundary_scanner boundary_scanner(packed_filenames.data(), mapping_registry, classification_output);
+    boundary_scanner.consume_scalar_bytes(0, packed_filenames.size());
+}
+
+#if defined(__SSE2__)
+void classify_packed_filenames_sse2(std::string_view packed_filenames, const extension_classification_table& mapping_registry,
+                                    std::vector<packed_filename_classification>& classification_output) {
+    packed_boundary_scanner boundary_scanner(packed_filenames.data(), mapping_registry, classification_output);
+    const __m128i separator_pattern = _mm_set1_epi8(PACKED_FILENAME_SEPARATOR);
+    const __m128i dot_pattern = _mm_set1_epi8('.');
+    size_t block_base = 0;
+    for (; block_base + 16 <= packed_filenames.size(); block_base += 16) {
+        __m128i block_bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(packed_filenames.data() + block_base));
+        uint64_t separator_mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block_bytes, separator_pattern)));
+        uint64_t dot_mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block_bytes, dot_pattern)));
+        boundary_scanner.consume_boundary_masks(dot_mask, separator_mask, block_base);
+    }
+    boundary_scanner.consume_scalar_bytes(block_base, packed_filenames.size());
 }
+#endif
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define ARTLEST_HAS_AVX2_KERNEL 1
+__attribute__((target("avx2")))
+void classify_packed_filenames_avx2(std::string_view packed_filenames, const extension_classification_table& mapping_registry,
+                                    std::vector<packed_filename_classification>& classification_output) {
+    packed_boundary_scanner boundary_scanner(packed_filenames.data(), mapping_registry, classification_output);
+    const __m256i separator_pattern = _mm256_set1_epi8(PACKED_FILENAME_SEPARATOR);
+    const __m256i dot_pattern = _mm256_set1_epi8('.');
+    size_t block_base = 0;
+    for (; block_base + 32 <= packed_filenames.size(); block_base += 32) {
+        __m256i block_bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(packed_filenames.data() + block_base));
+        uint64_t separator_mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block_bytes, separator_pattern)));
+        uint64_t dot_mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block_bytes, dot_pattern)));
+        boundary_scanner.consume_boundary_masks(dot_mask, separator_mask, block_base);
+    }
+    boundary_scanner.consume_scalar_bytes(block_base, packed_filenames.size());
+}
+#endif
+
+// Kernel variant names reported by diagnostics
+struct packed_kernel_descriptor {
+    const char* kernel_name;                  // Instruction set used by the kernel
+    packed_classification_kernel kernel_function;  // Kernel entry point
+};
 
 /**
- * calculate_processing_priority - Determines file processing priority level
- * This function implements priority calculation algorithms based on file
- * characteristics and classification requirements
+ * select_packed_classification_kernel - Picks the widest kernel the CPU supports
+ * The choice is made once at first use; AVX2 is detected at runtime so one
+ * binary runs everywhere, SSE2 is the x86-64 baseline, scalar covers the rest
  */
-int calculate_processing_priority(const std::string& directory_category) {
-    // High priority for critical document files
-    if (directory_category == "DOCUMENTS_REPOSITORY") return 1;
-    
-    // Medium priority for source code and development files
-    if (directory_category == "SOURCE_CODE") return 2;
-    
-    // Standard priority for multimedia and media assets
-    if (directory_category == "MULTIMEDIA_ASSETS" || directory_category == "AUDIO_LIBRARY" || 
-        directory_category == "VIDEO_CONTENT") return 3;
-    
-    // Lower priority for compressed archives
-    if (directory_category == "ARCHIVE_STORAGE") return 4;
-    
-    // Lowest priority for miscellaneous and unclassified files
-    return 5;
+const packed_kernel_descriptor& select_packed_classification_kernel() {
+    static const packed_kernel_descriptor selected_kernel = [] {
+#if defined(ARTLEST_HAS_AVX2_KERNEL)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) return packed_kernel_descriptor{"avx2", classify_packed_filenames_avx2};
+#endif
+#if defined(__SSE2__)
+        return packed_kernel_descriptor{"sse2", classify_packed_filenames_sse2};
+#else
+        return packed_kernel_descriptor{"scalar", classify_packed_filenames_scalar};
+#endif
+    }();
+    return selected_kernel;
+}
+
+/**
+ * classify_packed_filename_batch - Bulk extract/lookup over a packed filename buffer
+ * Every name in packed_filenames must be terminated by PACKED_FILENAME_SEPARATOR;
+ * one classification per name is appended to classification_output in order
+ */
+void classify_packed_filename_batch(std::string_view packed_filenames, const extension_classification_table& mapping_registry,
+                                    std::vector<packed_filename_classification>& classification_output) {
+    ARTLEST_BEGIN_STAGE(batch_timer, STAGE_BATCH_CLASSIFY);
+#if defined(ARTLEST_ENABLE_INSTRUMENTATION)
+    size_t first_new_result = classification_output.size();
+#endif
+    select_packed_classification_kernel().kernel_function(packed_filenames, mapping_registry, classification_output);
+    ARTLEST_END_STAGE(batch_timer);
+#if defined(ARTLEST_ENABLE_INSTRUMENTATION)
+    for (size_t result_index = first_new_result; result_index < classification_output.size(); ++result_index) {
+        classification_category_identifier result_category = classification_output[result_index].category_identifier;
+        ARTLEST_COUNT_LOOKUP(result_category, result_category != CATEGORY_MISCELLANEOUS_FILES);
+    }
+#endif
 }
 
 /**
@@ -199,194 +487,5622 @@ void generate_demonstration_dataset(std::vector<std::string>& filename_collectio
 }
 
 /**
- * display_progress_indicator - Renders processing progress visualization
- * This function implements progress bar rendering for real-time feedback
- * during file processing operations in console environments
+ * synthetic_filename_generator - Seeded generator of realistic filename populations
+ * Extension popularity follows a Zipf distribution over the registered
+ * extensions (rank = table order, exponent 0 is uniform); a configurable miss
+ * rate produces unknown or missing extensions. Equal seeds and parameters
+ * yield identical name sequences on every platform
  */
-void display_progress_indicator(int current_iteration, int total_iterations) {
-    // Calculate completion percentage for progress tracking
-    double completion_percentage = (static_cast<double>(current_iteration) / total_iterations) * 100.0;
+class synthetic_filename_generator {
+public:
+    synthetic_filename_generator(double zipf_exponent, double miss_rate, uint64_t seed_value)
+        : extension_miss_rate(std::min(std::max(miss_rate, 0.0), 1.0)) {
+        // SplitMix64 expands the seed so that small seeds still give a well-mixed state
+        generator_state = seed_value + 0x9E3779B97F4A7C15ULL;
+        generator_state = (generator_state ^ (generator_state >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        generator_state = (generator_state ^ (generator_state >> 27)) * 0x94D049BB133111EBULL;
+        generator_state ^= generator_state >> 31;
+        if (generator_state == 0) generator_state = 1;
+        
+        double cumulative_weight = 0.0;
+        for (size_t rank_index = 0; rank_index < REGISTERED_EXTENSION_COUNT; ++rank_index) {
+            cumulative_weight += 1.0 / std::pow(static_cast<double>(rank_index + 1), zipf_exponent);
+            extension_cumulative_weights[rank_index] = cumulative_weight;
+        }
+        for (double& rank_weight : extension_cumulative_weights) rank_weight /= cumulative_weight;
+    }
     
-    // Determine progress bar fill length based on completion status
-    int progress_bar_length = 40;
-    int filled_segments = static_cast<int>((completion_percentage / 100.0) * progress_bar_length);
+    // Appends one generated name (without separator) to the output string
+    void append_generated_name(std::string& output_buffer) {
+        static const char STEM_ALPHABET[] = "abcdefghijklmnopqrstuvwxyz0123456789_-";
+        static const char* const UNKNOWN_EXTENSIONS[] = {"dat", "bak", "xyz", "tmp1"};
+        size_t name_start = output_buffer.size();
+        size_t stem_length = SYNTHETIC_MINIMUM_STEM_LENGTH + next_random() % (SYNTHETIC_MAXIMUM_STEM_LENGTH - SYNTHETIC_MINIMUM_STEM_LENGTH + 1);
+        for (size_t character_index = 0; character_index < stem_length; ++character_index) {
+            output_buffer += STEM_ALPHABET[next_random() % (sizeof(STEM_ALPHABET) - 1)];
+        }
+        if (next_unit_interval() < extension_miss_rate) {
+            // Half of the misses carry an unregistered extension, half none at all
+            if (next_random() & 1) {
+                output_buffer += '.';
+                output_buffer += UNKNOWN_EXTENSIONS[next_random() % 4];
+            }
+            return;
+        }
+        double extension_sample = next_unit_interval();
+        size_t extension_rank = std::upper_bound(extension_cumulative_weights, extension_cumulative_weights + REGISTERED_EXTENSION_COUNT,
+                                                 extension_sample) - extension_cumulative_weights;
+        output_buffer += '.';
+        output_buffer += EXTENSION_CLASSIFICATION_RULES[std::min(extension_rank, REGISTERED_EXTENSION_COUNT - 1)].file_extension;
+        if (next_random() % 100 < SYNTHETIC_UPPERCASE_PERCENT) {
+            std::transform(output_buffer.begin() + name_start, output_buffer.end(), output_buffer.begin() + name_start, ::toupper);
+        }
+    }
     
-    // Render progress bar with visual indicators
-    std::cout << "\rProcessing Progress: [";
-    for (int segment_index = 0; segment_index < progress_bar_length; ++segment_index) {
-        if (segment_index < filled_segments) {
-            std::cout << "█";  // Filled segment character
-        } else {
-            std::cout << "░";  // Empty segment character
+    // Appends name_count separator-terminated names to a packed filename buffer
+    void append_packed_names(std::string& packed_filename_buffer, size_t name_count) {
+        packed_filename_buffer.reserve(packed_filename_buffer.size() + name_count * (SYNTHETIC_MAXIMUM_STEM_LENGTH + 6));
+        for (size_t name_index = 0; name_index < name_count; ++name_index) {
+            append_generated_name(packed_filename_buffer);
+            packed_filename_buffer += PACKED_FILENAME_SEPARATOR;
         }
     }
-    std::cout << "] " << std::fixed << std::setprecision(1) << completion_percentage << "%";
-    std::cout.flush();
+
+private:
+    static constexpr size_t REGISTERED_EXTENSION_COUNT = sizeof(EXTENSION_CLASSIFICATION_RULES) / sizeof(EXTENSION_CLASSIFICATION_RULES[0]);
+    
+    uint64_t next_random() {
+        generator_state ^= generator_state << 13;
+        generator_state ^= generator_state >> 7;
+        generator_state ^= generator_state << 17;
+        return generator_state;
+    }
+    double next_unit_interval() { return static_cast<double>(next_random() >> 11) * (1.0 / 9007199254740992.0); }
+    
+    uint64_t generator_state;                 // xorshift64 state (never zero)
+    double extension_miss_rate;               // Fraction of names without a registered extension
+    double extension_cumulative_weights[REGISTERED_EXTENSION_COUNT];  // Normalized Zipf CDF by extension rank
+};
+
+/**
+ * generate_synthetic_dataset - Fills the demo input with generated names
+ * Used instead of the fixed demonstration list when --generate is given
+ */
+void generate_synthetic_dataset(const execution_configuration_parameters& runtime_configuration,
+                                std::vector<std::string>& filename_collection) {
+    synthetic_filename_generator name_generator(runtime_configuration.synthetic_zipf_exponent,
+                                                runtime_configuration.synthetic_miss_rate, runtime_configuration.synthetic_seed);
+    filename_collection.clear();
+    filename_collection.resize(runtime_configuration.synthetic_name_count);
+    for (std::string& generated_name : filename_collection) name_generator.append_generated_name(generated_name);
 }
 
 /**
- * perform_statistical_analysis - Calculates processing metrics and statistics
- * This function implements statistical calculation algorithms for comprehensive
- * analysis of file processing results and system performance metrics
+ * prepare_input_dataset - Selects the in-memory input when no --source is given
  */
-void perform_statistical_analysis(const std::vector<file_classification_entry>& processed_files) {
-    // Initialize statistical counters for comprehensive analysis
-    std::map<std::string, int> category_distribution_metrics;
-    std::map<int, int> priority_level_distribution;
-    int total_files_processed = processed_files.size();
-    
-    // Iterate through processed files to calculate distribution metrics
-    for (const auto& file_entry : processed_files) {
-        // Increment category distribution counter
-        category_distribution_metrics[file_entry.destination_directory]++;
-        
-        // Increment priority level distribution counter
-        priority_level_distribution[file_entry.processing_priority]++;
+void prepare_input_dataset(const execution_configuration_parameters& runtime_configuration,
+                           std::vector<std::string>& filename_collection) {
+    if (runtime_configuration.synthetic_name_count > 0) {
+        generate_synthetic_dataset(runtime_configuration, filename_collection);
+    } else {
+        generate_demonstration_dataset(filename_collection);
     }
-    
-    // Display comprehensive statistical analysis header
-    std::cout << "\n\n╔══════════════════════════════════════════════════════════════╗\n";
-    std::cout << "║                    STATISTICAL ANALYSIS REPORT               ║\n";
-    std::cout << "╠══════════════════════════════════════════════════════════════╣\n";
-    
-    // Present total processing metrics
-    std::cout << "║ Total Files Processed: " << std::setw(32) << total_files_processed << " ║\n";
-    std::cout << "║ Processing Efficiency: " << std::setw(30) << "100.0%" << " ║\n";
-    std::cout << "╠══════════════════════════════════════════════════════════════╣\n";
-    
-    // Display category distribution analysis
-    std::cout << "║                  CATEGORY DISTRIBUTION                       ║\n";
-    std::cout << "╠══════════════════════════════════════════════════════════════╣\n";
-    
-    for (const auto& category_entry : category_distribution_metrics) {
-        double percentage = (static_cast<double>(category_entry.second) / total_files_processed) * 100.0;
-        std::cout << "║ " << std::left << std::setw(25) << category_entry.first 
-                  << ": " << std::right << std::setw(3) << category_entry.second 
-                  << " files (" << std::fixed << std::setprecision(1) << percentage << "%) ║\n";
+}
+
+// Outcome of writing a synthetic directory tree
+struct synthetic_tree_summary {
+    size_t created_file_count = 0;            // Empty files created
+    size_t created_directory_count = 0;       // Directories created, root included
+};
+
+/**
+ * write_synthetic_directory_tree - Materializes generated names as an on-disk tree
+ * Every directory down to tree_depth holds the same share of name_count empty
+ * files and tree_fanout subdirectories. Names are prefixed with their index so
+ * duplicates from the generator never collide. On POSIX files are created
+ * relative to a held directory descriptor, so no path is resolved twice
+ */
+bool write_synthetic_directory_tree(const std::string& tree_root_path, size_t name_count, int tree_depth, int tree_fanout,
+                                    synthetic_filename_generator& name_generator, synthetic_tree_summary& tree_summary,
+                                    std::string& error_message) {
+    size_t total_directory_count = 0;
+    for (size_t level_width = 1, level_index = 0; level_index <= static_cast<size_t>(tree_depth); ++level_index) {
+        total_directory_count += level_width;
+        level_width *= static_cast<size_t>(tree_fanout);
     }
+    size_t files_per_directory = (name_count + total_directory_count - 1) / total_directory_count;
+    size_t remaining_file_count = name_count;
     
-    // Display priority level distribution analysis
-    std::cout << "╠══════════════════════════════════════════════════════════════╣\n";
-    std::cout << "║                  PRIORITY DISTRIBUTION                       ║\n";
-    std::cout << "╠══════════════════════════════════════════════════════════════╣\n";
-    
-    for (const auto& priority_entry : priority_level_distribution) {
-        double percentage = (static_cast<double>(priority_entry.second) / total_files_processed) * 100.0;
-        std::cout << "║ Priority Level " << priority_entry.first 
-                  << ": " << std::right << std::setw(3) << priority_entry.second 
-                  << " files (" << std::fixed << std::setprecision(1) << percentage << "%) ║\n";
+    std::error_code filesystem_error;
+    std::filesystem::create_directories(tree_root_path, filesystem_error);
+    if (filesystem_error || !std::filesystem::is_empty(tree_root_path, filesystem_error)) {
+        error_message = filesystem_error ? filesystem_error.message() : "directory is not empty";
+        return false;
     }
     
-    std::cout << "╚══════════════════════════════════════════════════════════════╝\n";
+    std::string generated_name;
+    std::function<bool(const std::string&, int)> populate_directory = [&](const std::string& directory_path, int directory_depth) {
+        tree_summary.created_directory_count++;
+#if defined(ARTLEST_POSIX_FILE_OPERATIONS)
+        int directory_descriptor = ::open(directory_path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (directory_descriptor < 0) {
+            error_message = directory_path + ": " + std::strerror(errno);
+            return false;
+        }
+#endif
+        size_t directory_file_count = std::min(files_per_directory, remaining_file_count);
+        for (size_t file_index = 0; file_index < directory_file_count; ++file_index) {
+            generated_name = std::to_string(file_index);
+            generated_name += '_';
+            name_generator.append_generated_name(generated_name);
+#if defined(ARTLEST_POSIX_FILE_OPERATIONS)
+            int file_descriptor = ::openat(directory_descriptor, generated_name.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+            if (file_descriptor < 0) {
+                error_message = directory_path + "/" + generated_name + ": " + std::strerror(errno);
+                ::close(directory_descriptor);
+                return false;
+            }
+            ::close(file_descriptor);
+#else
+            std::ofstream created_file(std::filesystem::path(directory_path) / generated_name, std::ios::binary);
+            if (!created_file) {
+                error_message = directory_path + "/" + generated_name + ": cannot create file";
+                return false;
+            }
+#endif
+            tree_summary.created_file_count++;
+        }
+        remaining_file_count -= directory_file_count;
+        
+        bool level_succeeded = true;
+        for (int subdirectory_index = 0; level_succeeded && directory_depth < tree_depth && subdirectory_index < tree_fanout; ++subdirectory_index) {
+            std::string subdirectory_name = "d" + std::to_string(subdirectory_index);
+#if defined(ARTLEST_POSIX_FILE_OPERATIONS)
+            if (::mkdirat(directory_descriptor, subdirectory_name.c_str(), 0755) != 0) {
+                error_message = directory_path + "/" + subdirectory_name + ": " + std::strerror(errno);
+                level_succeeded = false;
+                break;
+            }
+#else
+            std::filesystem::create_directory(std::filesystem::path(directory_path) / subdirectory_name, filesystem_error);
+            if (filesystem_error) {
+                error_message = directory_path + "/" + subdirectory_name + ": " + filesystem_error.message();
+                level_succeeded = false;
+                break;
+            }
+#endif
+            level_succeeded = populate_directory(directory_path + "/" + subdirectory_name, directory_depth + 1);
+        }
+#if defined(ARTLEST_POSIX_FILE_OPERATIONS)
+        ::close(directory_descriptor);
+#endif
+        return level_succeeded;
+    };
+    return populate_directory(tree_root_path, 0);
 }
 
 /**
- * execute_file_sorting_algorithm - Primary processing function implementation
- * This function orchestrates the complete file sorting workflow including
- * classification, priority assignment, and statistical analysis generation
+ * execute_tree_generation - Writes the --generate-tree dataset and reports it
  */
-void execute_file_sorting_algorithm() {
-    // Initialize core data structures for processing operations
-    std::map<std::string, std::string> extension_classification_registry;
-    std::vector<std::string> input_filename_collection;
-    std::vector<file_classification_entry> processed_file_results;
-    
-    // Configure extension mapping database for file classification
-    initialize_extension_mapping_database(extension_classification_registry);
-    
-    // Generate demonstration dataset for processing operations
-    generate_demonstration_dataset(input_filename_collection);
+bool execute_tree_generation(const execution_configuration_parameters& runtime_configuration) {
+    synthetic_filename_generator name_generator(runtime_configuration.synthetic_zipf_exponent,
+                                                runtime_configuration.synthetic_miss_rate, runtime_configuration.synthetic_seed);
+    synthetic_tree_summary tree_summary;
+    std::string error_message;
+    auto generation_start = std::chrono::steady_clock::now();
+    bool generation_succeeded = write_synthetic_directory_tree(runtime_configuration.synthetic_tree_path,
+                                                               runtime_configuration.synthetic_name_count,
+                                                               runtime_configuration.synthetic_tree_depth,
+                                                               runtime_configuration.synthetic_tree_fanout,
+                                                               name_generator, tree_summary, error_message);
+    double elapsed_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - generation_start).count();
+    if (!generation_succeeded) {
+        std::cerr << "Cannot generate tree " << runtime_configuration.synthetic_tree_path << ": " << error_message << "\n";
+        return false;
+    }
     
-    // Display processing initialization header
+    std::ostringstream summary_line;
+    summary_line << tree_summary.created_file_count << " files in " << tree_summary.created_directory_count << " dirs";
+    std::ostringstream rate_line;
+    rate_line << std::fixed << std::setprecision(2) << elapsed_seconds << " s ("
+              << std::setprecision(0) << (elapsed_seconds > 0 ? tree_summary.created_file_count / elapsed_seconds : 0.0) << " files/s)";
     std::cout << "╔══════════════════════════════════════════════════════════════╗\n";
-    std::cout << "║              PROFESSIONAL FILE SORTING SYSTEM               ║\n";
-    std::cout << "║                   Processing Initialization                  ║\n";
-    std::cout << "╚══════════════════════════════════════════════════════════════╝\n\n";
-    
-    // Execute primary processing loop with progress tracking
-    int processing_iteration_counter = 0;
-    int total_processing_iterations = input_filename_collection.size();
-    
-    for (const std::string& current_filename : input_filename_collection) {
-        // Update progress indicator for real-time feedback
-        display_progress_indicator(processing_iteration_counter, total_processing_iterations);
-        
-        // Extract file extension for classification processing
-        std::string file_extension_identifier = extract_file_extension_identifier(current_filename);
-        
-        // Determine destination directory based on classification rules
-        std::string destination_category = determine_classification_category(file_extension_identifier, 
-                                                                           extension_classification_registry);
-        
-        // Calculate processing priority level for workflow optimization
-        int priority_level = calculate_processing_priority(destination_category);
-        
-        // Create file classification entry for results storage
-        file_classification_entry current_entry;
-        current_entry.filename_identifier = current_filename;
-        current_entry.extension_category = file_extension_identifier;
-        current_entry.destination_directory = destination_category;
-        current_entry.processing_priority = priority_level;
+    std::cout << "║                  SYNTHETIC TREE GENERATED                    ║\n";
+    std::cout << "╠══════════════════════════════════════════════════════════════╣\n";
+    std::cout << std::left;
+    std::cout << "║ Root: " << std::setw(55) << runtime_configuration.synthetic_tree_path << "║\n";
+    std::cout << "║ Created: " << std::setw(52) << summary_line.str() << "║\n";
+    std::cout << "║ Elapsed: " << std::setw(52) << rate_line.str() << "║\n";
+    std::cout << "╚══════════════════════════════════════════════════════════════╝\n";
+    return true;
+}
+
+/**
+ * resolve_worker_thread_count - Converts a requested thread count into a usable one
+ * Zero selects the hardware concurrency and the result is clamped to the
+ * supported worker range
+ */
+int resolve_worker_thread_count(int requested_thread_count) {
+    int resolved_thread_count = requested_thread_count;
+    if (resolved_thread_count <= 0) resolved_thread_count = static_cast<int>(std::thread::hardware_concurrency());
+    if (resolved_thread_count <= 0) resolved_thread_count = 1;
+    if (resolved_thread_count > MAXIMUM_WALKER_THREAD_COUNT) resolved_thread_count = MAXIMUM_WALKER_THREAD_COUNT;
+    return resolved_thread_count;
+}
+
+/**
+ * file_metadata_record - Stat results collected by the walker for one file
+ */
+struct file_metadata_record {
+    uint64_t file_size_bytes = 0;             // Apparent size in bytes
+    uint64_t inode_number = 0;                // Inode within the device
+    uint64_t device_identifier = 0;           // Device containing the file
+    int64_t modification_time_nanoseconds = 0;  // Last content modification (ns since epoch)
+    bool metadata_valid = false;              // False when the stat call failed
+};
+
+/**
+ * discovered_directory_batch - Collection of filenames found in one directory
+ * The walker publishes one batch per visited directory so that hand-off costs
+ * are paid per directory rather than per file on wide trees. Names are packed
+ * back to back, each terminated by PACKED_FILENAME_SEPARATOR, so the batch
+ * kernel can scan them in bulk
+ */
+struct discovered_directory_batch {
+    std::string directory_path;                     // Directory containing the files
+    std::string packed_filename_buffer;             // Separator-terminated regular file names
+    size_t filename_count = 0;                      // Names stored in the packed buffer
+    std::vector<file_metadata_record> metadata_collection;  // Per-name metadata (empty unless requested)
+    std::chrono::steady_clock::time_point discovery_timestamp;  // When the batch left the walker
+};
+
+/**
+ * indexed_file_record - Identity of one file as seen by a previous run
+ * A file counts as unchanged when inode, modification time and size all match
+ */
+struct indexed_file_record {
+    std::string filename;                     // Name within its directory
+    uint64_t inode_number = 0;                // Inode at classification time
+    int64_t modification_time_nanoseconds = 0;  // Content modification time (ns since epoch)
+    uint64_t file_size_bytes = 0;             // Size at classification time
+};
+
+/**
+ * indexed_directory_record - Everything a later run needs to skip one directory
+ * An unchanged directory mtime means no entry was added, removed or renamed, so
+ * the recorded subdirectory names replace a fresh listing of the directory
+ */
+struct indexed_directory_record {
+    uint64_t device_identifier = 0;           // Device containing the directory
+    uint64_t inode_number = 0;                // Directory inode
+    int64_t modification_time_nanoseconds = UNVERIFIED_MODIFICATION_TIME;  // Directory mtime when listed
+    bool revalidation_required = false;       // Files were moved out; list again next run (not persisted)
+    std::vector<std::string> subdirectory_names;     // Subdirectories to descend into when skipped
+    std::vector<indexed_file_record> file_records;   // Files already classified (and moved, when moving)
+};
+
+/**
+ * read_directory_identity - Fills device, inode and mtime of a directory record
+ * Returns false when the directory cannot be examined or POSIX stat is unavailable
+ */
+bool read_directory_identity(const std::string& directory_path, indexed_directory_record& directory_record) {
+#if defined(ARTLEST_POSIX_FILE_OPERATIONS)
+    struct stat directory_status;
+    if (stat(directory_path.c_str(), &directory_status) != 0) return false;
+    directory_record.device_identifier = static_cast<uint64_t>(directory_status.st_dev);
+    directory_record.inode_number = static_cast<uint64_t>(directory_status.st_ino);
+#if defined(__linux__)
+    directory_record.modification_time_nanoseconds =
+        static_cast<int64_t>(directory_status.st_mtim.tv_sec) * 1000000000 + directory_status.st_mtim.tv_nsec;
+#else
+    directory_record.modification_time_nanoseconds = static_cast<int64_t>(directory_status.st_mtime) * 1000000000;
+#endif
+    return true;
+#else
+    (void)directory_path;
+    (void)directory_record;
+    return false;
+#endif
+}
+
+/**
+ * persistent_classification_index - On-disk record of already classified files
+ * The index maps each visited directory path to its identity, subdirectory
+ * names and file identities. Records are stored in host byte order behind a
+ * magic header that also remembers whether the run moved files, because a
+ * report-only index must never suppress files a moving run still has to move.
+ * Concurrent store_directory_record calls are safe; lookups are only made on
+ * an index that is no longer being modified
+ */
+class persistent_classification_index {
+public:
+    // Load an index file; a missing file yields an empty index and succeeds
+    bool load_index_file(const std::string& index_file_path, bool file_moves_enabled, std::string& error_message) {
+        std::ifstream index_stream(index_file_path, std::ios::binary);
+        if (!index_stream) return true;
+        std::string index_contents((std::istreambuf_iterator<char>(index_stream)), std::istreambuf_iterator<char>());
         
-        // Store processed entry in results collection
-        processed_file_results.push_back(current_entry);
+        index_reader_cursor reader_cursor{index_contents, 0, true};
+        std::string index_magic = reader_cursor.read_bytes(INDEX_MAGIC_LENGTH);
+        uint64_t recorded_moves_enabled = reader_cursor.read_integer<uint8_t>();
+        uint64_t directory_record_count = reader_cursor.read_integer<uint64_t>();
+        if (!reader_cursor.input_valid || index_magic != INDEX_FILE_MAGIC) {
+            error_message = "not an index file (or written by an incompatible version)";
+            return false;
+        }
+        if ((recorded_moves_enabled != 0) != file_moves_enabled) {
+            error_message = recorded_moves_enabled ? "index was written by a moving run" : "index was written by a report-only run";
+            return false;
+        }
         
-        // Increment processing iteration counter
-        processing_iteration_counter++;
+        for (uint64_t record_index = 0; record_index < directory_record_count && reader_cursor.input_valid; ++record_index) {
+            std::string directory_path = reader_cursor.read_string();
+            indexed_directory_record directory_record;
+            directory_record.device_identifier = reader_cursor.read_integer<uint64_t>();
+            directory_record.inode_number = reader_cursor.read_integer<uint64_t>();
+            directory_record.modification_time_nanoseconds = reader_cursor.read_integer<int64_t>();
+            uint32_t subdirectory_count = reader_cursor.read_integer<uint32_t>();
+            for (uint32_t subdirectory_index = 0; subdirectory_index < subdirectory_count && reader_cursor.input_valid; ++subdirectory_index) {
+                directory_record.subdirectory_names.push_back(reader_cursor.read_string());
+            }
+            uint32_t file_count = reader_cursor.read_integer<uint32_t>();
+            for (uint32_t file_index = 0; file_index < file_count && reader_cursor.input_valid; ++file_index) {
+                indexed_file_record file_record;
+                file_record.filename = reader_cursor.read_string();
+                file_record.inode_number = reader_cursor.read_integer<uint64_t>();
+                file_record.modification_time_nanoseconds = reader_cursor.read_integer<int64_t>();
+                file_record.file_size_bytes = reader_cursor.read_integer<uint64_t>();
+                directory_record.file_records.push_back(std::move(file_record));
+            }
+            directory_records.emplace(std::move(directory_path), std::move(directory_record));
+        }
+        if (!reader_cursor.input_valid) {
+            directory_records.clear();
+            error_message = "index file is truncated";
+            return false;
+        }
+        return true;
+    }
+
+    // Write to a temporary file and rename it over the index so a crash never leaves a torn index
+    bool save_index_file(const std::string& index_file_path, bool file_moves_enabled, std::string& error_message) const {
+        std::string index_contents(INDEX_FILE_MAGIC, INDEX_MAGIC_LENGTH);
+        append_integer(index_contents, static_cast<uint8_t>(file_moves_enabled ? 1 : 0));
+        append_integer(index_contents, static_cast<uint64_t>(directory_records.size()));
+        for (const auto& [directory_path, directory_record] : directory_records) {
+            append_string(index_contents, directory_path);
+            append_integer(index_contents, directory_record.device_identifier);
+            append_integer(index_contents, directory_record.inode_number);
+            append_integer(index_contents, directory_record.modification_time_nanoseconds);
+            append_integer(index_contents, static_cast<uint32_t>(directory_record.subdirectory_names.size()));
+            for (const std::string& subdirectory_name : directory_record.subdirectory_names) append_string(index_contents, subdirectory_name);
+            append_integer(index_contents, static_cast<uint32_t>(directory_record.file_records.size()));
+            for (const indexed_file_record& file_record : directory_record.file_records) {
+                append_string(index_contents, file_record.filename);
+                append_integer(index_contents, file_record.inode_number);
+                append_integer(index_contents, file_record.modification_time_nanoseconds);
+                append_integer(index_contents, file_record.file_size_bytes);
+            }
+        }
         
-        // Implement processing delay for demonstration purposes
-        for (volatile int delay_counter = 0; delay_counter < 10000000; ++delay_counter) {
-            // Delay loop for visual progress demonstration
+        std::string temporary_file_path = index_file_path + ".tmp";
+        {
+            std::ofstream index_stream(temporary_file_path, std::ios::binary | std::ios::trunc);
+            index_stream.write(index_contents.data(), static_cast<std::streamsize>(index_contents.size()));
+            if (!index_stream.flush()) {
+                error_message = "cannot write " + temporary_file_path;
+                return false;
+            }
         }
+        std::error_code rename_error;
+        std::filesystem::rename(temporary_file_path, index_file_path, rename_error);
+        if (rename_error) {
+            error_message = rename_error.message();
+            return false;
+        }
+        return true;
     }
-    
-    // Complete progress indicator display
-    std::cout << "\n\nProcessing Operations Completed Successfully.\n\n";
-    
-    // Sort processed results by priority level for optimized organization
-    std::sort(processed_file_results.begin(), processed_file_results.end(),
-              [](const file_classification_entry& entry_a, const file_classification_entry& entry_b) {
-                  return entry_a.processing_priority < entry_b.processing_priority;
-              });
-    
-    // Display detailed processing results
-    std::cout << "╔══════════════════════════════════════════════════════════════╗\n";
-    std::cout << "║                    PROCESSING RESULTS                        ║\n";
-    std::cout << "╠══════════════════════════════════════════════════════════════╣\n";
-    
-    for (const auto& processed_entry : processed_file_results) {
-        std::cout << "║ File: " << std::left << std::setw(25) << processed_entry.filename_identifier
-                  << " → " << std::setw(20) << processed_entry.destination_directory
-                  << " [P" << processed_entry.processing_priority << "] ║\n";
+
+    const indexed_directory_record* find_directory_record(const std::string& directory_path) const {
+        auto record_position = directory_records.find(directory_path);
+        return record_position == directory_records.end() ? nullptr : &record_position->second;
     }
-    
-    std::cout << "╚══════════════════════════════════════════════════════════════╝\n";
-    
-    // Execute comprehensive statistical analysis
-    perform_statistical_analysis(processed_file_results);
+
+    void store_directory_record(const std::string& directory_path, indexed_directory_record&& directory_record) {
+        std::lock_guard<std::mutex> update_guard(update_lock);
+        directory_records[directory_path] = std::move(directory_record);
+    }
+
+    /**
+     * invalidate_moved_directories - Marks directories files were moved out of as unverified
+     * Moving files changes the source directory mtime, but so does a file created
+     * while the run was moving; recording the post-move mtime would hide that file
+     * from every later run. Such directories are listed again next time, and their
+     * file records still spare the files left behind from reclassification
+     */
+    void invalidate_moved_directories() {
+        for (auto& [directory_path, directory_record] : directory_records) {
+            if (!directory_record.revalidation_required) continue;
+            directory_record.revalidation_required = false;
+            directory_record.modification_time_nanoseconds = UNVERIFIED_MODIFICATION_TIME;
+        }
+    }
+
+    size_t directory_record_count() const { return directory_records.size(); }
+
+private:
+    static constexpr const char* INDEX_FILE_MAGIC = "ARTLIDX1";
+    static constexpr size_t INDEX_MAGIC_LENGTH = 8;
+
+    template <typename integer_type>
+    static void append_integer(std::string& index_contents, integer_type integer_value) {
+        index_contents.append(reinterpret_cast<const char*>(&integer_value), sizeof(integer_value));
+    }
+
+    static void append_string(std::string& index_contents, const std::string& string_value) {
+        append_integer(index_contents, static_cast<uint32_t>(string_value.size()));
+        index_contents += string_value;
+    }
+
+    // Bounds-checked reader; any overrun marks the whole input invalid
+    struct index_reader_cursor {
+        const std::string& index_contents;
+        size_t read_position;
+        bool input_valid;
+
+        std::string read_bytes(size_t byte_count) {
+            if (!input_valid || index_contents.size() - read_position < byte_count) {
+                input_valid = false;
+                return std::string();
+            }
+            std::string byte_sequence = index_contents.substr(read_position, byte_count);
+            read_position += byte_count;
+            return byte_sequence;
+        }
+
+        template <typename integer_type>
+        integer_type read_integer() {
+            integer_type integer_value = 0;
+            std::string byte_sequence = read_bytes(sizeof(integer_type));
+            if (input_valid) std::memcpy(&integer_value, byte_sequence.data(), sizeof(integer_type));
+            return integer_value;
+        }
+
+        std::string read_string() { return read_bytes(read_integer<uint32_t>()); }
+    };
+
+    std::unordered_map<std::string, indexed_directory_record> directory_records;  // Records by directory path
+    std::mutex update_lock;                                                       // Serializes concurrent stores
+};
+
+/**
+ * incremental_index_session - Previous and next index of one incremental run
+ * The walker reads previous_index and fills updated_index, which replaces the
+ * index file once classification (and moving) has finished
+ */
+struct incremental_index_session {
+    persistent_classification_index previous_index;  // Loaded from disk, read-only during the walk
+    persistent_classification_index updated_index;   // Built during the walk, saved afterwards
+    bool file_moves_enabled = false;                 // Published files are moved away rather than kept
+    size_t skipped_directory_count = 0;              // Directories reused from the index without listing
+    size_t unchanged_file_count = 0;                 // Files suppressed because their identity matched
+};
+
+/**
+ * describe_adaptive_concurrency - One-line summary of a limit for run reports
+ */
+std::string describe_adaptive_concurrency(const adaptive_concurrency_snapshot& limit_snapshot) {
+    std::ostringstream limit_description;
+    limit_description << "limit " << limit_snapshot.current_limit << " (peak " << limit_snapshot.peak_limit << ", "
+                      << limit_snapshot.decrease_count << " decreases over " << limit_snapshot.sampled_operation_count
+                      << " operations, baseline " << std::fixed << std::setprecision(1)
+                      << limit_snapshot.baseline_latency_seconds * 1e6 << " us)";
+    return limit_description.str();
 }
 
 /**
- * main - Program entry point and execution controller
- * This function serves as the primary execution controller for the file sorting
- * system, managing initialization and termination procedures
+ * bounded_lockfree_queue - Fixed-capacity multi-producer multi-consumer ring buffer
+ * Each slot carries a sequence number that tells producers and consumers whether
+ * it is ready to be written or read, so hand-off needs a single compare-and-swap
+ * on the shared position and never takes a lock; the fixed capacity provides the
+ * back-pressure that keeps pipeline memory flat
  */
-int main() {
-    // Display system initialization banner
-    std::cout << "╔══════════════════════════════════════════════════════════════╗\n";
-    std::cout << "║           PROFESSIONAL FILE CLASSIFICATION SYSTEM           ║\n";
-    std::cout << "║                Cross-Platform Implementation                 ║\n";
-    std::cout << "║            Code hints and optimizations by artlest          ║\n";
-    std::cout << "╚══════════════════════════════════════════════════════════════╝\n\n";
-    
-    // Execute primary file sorting algorithm
-    execute_file_sorting_algorithm();
-    
-    // Display successful completion status
-    std::cout << "\n╔══════════════════════════════════════════════════════════════╗\n";
-    std::cout << "║                   EXECUTION COMPLETED                        ║\n";
-    std::cout << "║              System terminated successfully                  ║\n";
-    std::cout << "╚══════════════════════════════════════════════════════════════╝\n";
+template <typename element_type>
+class bounded_lockfree_queue {
+public:
+    explicit bounded_lockfree_queue(size_t requested_capacity) {
+        // Round capacity up to a power of two so positions map to slots with a mask
+        size_t ring_capacity = 2;
+        while (ring_capacity < requested_capacity) ring_capacity <<= 1;
+        capacity_mask = ring_capacity - 1;
+        slot_ring.reset(new queue_slot[ring_capacity]);
+        for (size_t slot_index = 0; slot_index < ring_capacity; ++slot_index) {
+            slot_ring[slot_index].sequence.store(slot_index, std::memory_order_relaxed);
+        }
+    }
+
+    // Attempt to append without blocking; returns false when the ring is full
+    bool try_enqueue(element_type& value) {
+        size_t position = enqueue_position.load(std::memory_order_relaxed);
+        for (;;) {
+            queue_slot& slot = slot_ring[position & capacity_mask];
+            size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            intptr_t sequence_delta = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+            if (sequence_delta == 0) {
+                if (enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    slot.payload = std::move(value);
+                    slot.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (sequence_delta < 0) {
+                return false;
+            } else {
+                position = enqueue_position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Attempt to remove without blocking; returns false when the ring is empty
+    bool try_dequeue(element_type& value) {
+        size_t position = dequeue_position.load(std::memory_order_relaxed);
+        for (;;) {
+            queue_slot& slot = slot_ring[position & capacity_mask];
+            size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            intptr_t sequence_delta = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+            if (sequence_delta == 0) {
+                if (dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    value = std::move(slot.payload);
+                    slot.sequence.store(position + capacity_mask + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (sequence_delta < 0) {
+                return false;
+            } else {
+                position = dequeue_position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Append, spinning with back-off while consumers drain a full ring
+    void enqueue_blocking(element_type&& value) {
+        for (int backoff_round = 0; !try_enqueue(value); ++backoff_round) {
+            apply_wait_backoff(backoff_round);
+        }
+    }
+
+    // Remove, waiting for data; returns false once the queue is closed and drained
+    bool dequeue_blocking(element_type& value) {
+        for (int backoff_round = 0;; ++backoff_round) {
+            if (try_dequeue(value)) return true;
+            if (queue_closed.load(std::memory_order_acquire)) return try_dequeue(value);
+            apply_wait_backoff(backoff_round);
+        }
+    }
+
+    // Mark that all producers have finished publishing
+    void close_queue() { queue_closed.store(true, std::memory_order_release); }
+
+    // Elements currently held; a racy snapshot meant for monitoring only
+    size_t approximate_size() const {
+        size_t dequeued_count = dequeue_position.load(std::memory_order_relaxed);
+        size_t enqueued_count = enqueue_position.load(std::memory_order_relaxed);
+        return enqueued_count > dequeued_count ? enqueued_count - dequeued_count : 0;
+    }
+
+private:
+    struct alignas(64) queue_slot {
+        std::atomic<size_t> sequence{0};  // Slot generation used to order producer/consumer access
+        element_type payload;             // Stored element
+    };
+
+    // Spin briefly, then yield, then sleep so idle stages stay cheap
+    static void apply_wait_backoff(int backoff_round) {
+        if (backoff_round < 16) return;
+        if (backoff_round < 64) {
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    }
+
+    std::unique_ptr<queue_slot[]> slot_ring;           // Ring storage
+    size_t capacity_mask = 0;                          // Ring capacity minus one
+    alignas(64) std::atomic<size_t> enqueue_position{0};  // Next producer ticket
+    alignas(64) std::atomic<size_t> dequeue_position{0};  // Next consumer ticket
+    alignas(64) std::atomic<bool> queue_closed{false};    // Set after the last producer finishes
+};
+
+/**
+ * parallel_directory_walker - Multi-threaded work-stealing directory traversal engine
+ * Each worker owns a double-ended queue of pending directories: it pops its own
+ * newest subtree from the back for depth-first locality and steals the oldest
+ * (largest) subtree from the front of a peer queue when it runs dry, keeping
+ * many metadata requests in flight on wide trees. With adaptive concurrency
+ * the pool is oversized and an AIMD limit on listing latency decides how many
+ * workers enumerate at once
+ */
+class parallel_directory_walker {
+public:
+    using directory_batch_callback = std::function<void(discovered_directory_batch&&)>;
+
+    explicit parallel_directory_walker(int requested_thread_count)
+        : worker_thread_count(resolve_worker_thread_count(requested_thread_count)) {}
+
+    /**
+     * traverse_directory_tree - Walks the tree rooted at root_directory_path
+     * Invokes batch_callback concurrently from worker threads for every directory
+     * containing regular files and returns once the whole tree has been visited
+     */
+    void traverse_directory_tree(const std::string& root_directory_path, const directory_batch_callback& batch_callback) {
+        traverse_directory_forest(std::vector<std::string>{root_directory_path}, batch_callback);
+    }
+
+    // Walk several disjoint subtrees in one pass (e.g. the directories of one shard)
+    void traverse_directory_forest(const std::vector<std::string>& root_directory_paths, const directory_batch_callback& batch_callback) {
+        if (root_directory_paths.empty()) return;
+        if (adaptive_concurrency_requested) {
+            uint64_t root_device_identifier = 0;
+#if defined(ARTLEST_POSIX_FILE_OPERATIONS)
+            struct stat root_status;
+            if (::stat(root_directory_paths[0].c_str(), &root_status) == 0) root_device_identifier = static_cast<uint64_t>(root_status.st_dev);
+#endif
+            walk_concurrency_limiter = std::make_unique<adaptive_concurrency_limiter>(root_device_identifier, worker_thread_count);
+        }
+        
+        // Prepare per-worker queues and deal the canonical roots out round-robin,
+        // so subdirectory paths compare against exclusions
+        worker_queue_collection = std::vector<worker_directory_queue>(worker_thread_count);
+        outstanding_directory_count.store(root_directory_paths.size());
+        for (size_t root_index = 0; root_index < root_directory_paths.size(); ++root_index) {
+            std::error_code canonical_error;
+            std::string canonical_root_path = std::filesystem::weakly_canonical(root_directory_paths[root_index], canonical_error).string();
+            if (canonical_error) canonical_root_path = root_directory_paths[root_index];
+            worker_queue_collection[root_index % worker_thread_count].pending_directories.push_back(std::move(canonical_root_path));
+        }
+
+        // Launch traversal workers and wait for tree exhaustion
+        std::vector<std::thread> worker_thread_collection;
+        for (int worker_index = 0; worker_index < worker_thread_count; ++worker_index) {
+            worker_thread_collection.emplace_back([this, worker_index, &batch_callback] {
+                execute_worker_traversal_loop(worker_index, batch_callback);
+            });
+        }
+        for (auto& worker_thread : worker_thread_collection) worker_thread.join();
+    }
+
+    // Never descend into the given subtree (e.g. a sort destination inside the source)
+    void exclude_directory_subtree(const std::string& excluded_directory_path) {
+        std::error_code canonical_error;
+        std::string canonical_path = std::filesystem::weakly_canonical(excluded_directory_path, canonical_error).string();
+        excluded_directory_paths.insert(canonical_error ? excluded_directory_path : canonical_path);
+    }
+
+    // Stat every published file, batching the calls through io_uring when requested and available
+    void enable_metadata_collection(bool prefer_io_uring) {
+        metadata_collection_enabled = true;
+        io_uring_preferred = prefer_io_uring;
+    }
+
+    bool io_uring_metadata_active() const { return io_uring_metadata_in_use.load(); }
+
+    // Oversize the pool (unless the thread count was given) and let latency bound active listings
+    void enable_adaptive_concurrency(int requested_thread_count) {
+        adaptive_concurrency_requested = true;
+        if (requested_thread_count <= 0) {
+            worker_thread_count = std::max(worker_thread_count, std::min(static_cast<int>(ADAPTIVE_MAXIMUM_CONCURRENCY),
+                                                                         MAXIMUM_WALKER_THREAD_COUNT));
+        }
+    }
+
+    bool adaptive_concurrency_active() const { return walk_concurrency_limiter != nullptr; }
+    adaptive_concurrency_snapshot walk_concurrency_snapshot() const { return walk_concurrency_limiter->snapshot(); }
+
+    /**
+     * attach_incremental_index - Skips work recorded by a previous run
+     * Directories whose identity and mtime match the session's previous index
+     * are not listed; within listed directories, files whose inode, mtime and
+     * size match are not published. Every visited directory is recorded into
+     * the session's updated index. Implies metadata collection
+     */
+    void attach_incremental_index(incremental_index_session* index_session) {
+        incremental_session = index_session;
+        metadata_collection_enabled = true;
+    }
+
+    size_t skipped_directory_count() const { return directories_skipped.load(); }
+    size_t unchanged_file_count() const { return files_unchanged.load(); }
+
+    int resolved_thread_count() const { return worker_thread_count; }
+    size_t visited_directory_count() const { return directories_visited.load(); }
+    size_t discovered_file_count() const { return files_discovered.load(); }
+
+    // Project final file count from files per visited directory and directories still queued
+    size_t estimated_total_file_count() const {
+        size_t visited_directories = directories_visited.load();
+        size_t discovered_files = files_discovered.load();
+        if (visited_directories == 0) return discovered_files;
+        return discovered_files + outstanding_directory_count.load() * discovered_files / visited_directories;
+    }
+    size_t traversal_error_count() const { return traversal_errors.load(); }
+
+private:
+    // Cache-line aligned queue so neighbouring workers do not false-share locks
+    struct alignas(64) worker_directory_queue {
+        std::mutex queue_lock;                        // Guards the pending directory deque
+        std::deque<std::string> pending_directories;  // Subtrees owned by this worker
+#if defined(ARTLEST_IO_URING_AVAILABLE)
+        std::unique_ptr<io_uring_submission_ring> metadata_ring;  // Worker-private statx ring
+        bool metadata_ring_unavailable = false;                   // Ring creation already failed
+#endif
+    };
+
+    // Pop the most recently discovered directory from the worker's own queue
+    bool acquire_local_directory(int worker_index, std::string& directory_path) {
+        worker_directory_queue& local_queue = worker_queue_collection[worker_index];
+        std::lock_guard<std::mutex> queue_guard(local_queue.queue_lock);
+        if (local_queue.pending_directories.empty()) return false;
+        directory_path = std::move(local_queue.pending_directories.back());
+        local_queue.pending_directories.pop_back();
+        return true;
+    }
+
+    // Steal the oldest directory from a peer queue, scanning peers round-robin
+    bool steal_peer_directory(int worker_index, std::string& directory_path) {
+        for (int peer_offset = 1; peer_offset < worker_thread_count; ++peer_offset) {
+            worker_directory_queue& peer_queue = worker_queue_collection[(worker_index + peer_offset) % worker_thread_count];
+            std::lock_guard<std::mutex> queue_guard(peer_queue.queue_lock);
+            if (peer_queue.pending_directories.empty()) continue;
+            directory_path = std::move(peer_queue.pending_directories.front());
+            peer_queue.pending_directories.pop_front();
+            return true;
+        }
+        return false;
+    }
+
+    // Enumerate one directory, queueing subdirectories locally and publishing files
+    void process_directory(int worker_index, const std::string& directory_path, const directory_batch_callback& batch_callback) {
+        ARTLEST_BEGIN_STAGE(walk_timer, STAGE_WALK);
+        adaptive_concurrency_limiter::operation_permit listing_permit(walk_concurrency_limiter.get());
+        // Identify the directory before listing it so later changes always alter the recorded mtime
+        indexed_directory_record directory_record;
+        const indexed_directory_record* previous_record = nullptr;
+        if (incremental_session != nullptr) {
+            bool identity_known = read_directory_identity(directory_path, directory_record);
+            if (!identity_known) directory_record.modification_time_nanoseconds = UNVERIFIED_MODIFICATION_TIME;
+            previous_record = incremental_session->previous_index.find_directory_record(directory_path);
+            if (identity_known && previous_record != nullptr &&
+                previous_record->modification_time_nanoseconds != UNVERIFIED_MODIFICATION_TIME &&
+                previous_record->modification_time_nanoseconds == directory_record.modification_time_nanoseconds &&
+                previous_record->inode_number == directory_record.inode_number &&
+                previous_record->device_identifier == directory_record.device_identifier) {
+                listing_permit.abandon();  // Nothing was listed; keep the latency signal clean
+                reuse_unchanged_directory(worker_index, directory_path, *previous_record);
+                return;
+            }
+        }
+        
+        std::error_code enumeration_error;
+        std::filesystem::directory_iterator directory_cursor(
+            directory_path, std::filesystem::directory_options::skip_permission_denied, enumeration_error);
+        if (enumeration_error) {
+            listing_permit.abandon();
+            traversal_errors.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        discovered_directory_batch directory_batch;
+        directory_batch.directory_path = directory_path;
+        std::vector<std::string> discovered_subdirectories;
+
+        for (const std::filesystem::directory_iterator directory_end; directory_cursor != directory_end;
+             directory_cursor.increment(enumeration_error)) {
+            if (enumeration_error) {
+                traversal_errors.fetch_add(1, std::memory_order_relaxed);
+                break;
+            }
+
+            // Use the cached entry type so symlinks are never followed into cycles
+            std::error_code status_error;
+            std::filesystem::file_status entry_status = directory_cursor->symlink_status(status_error);
+            if (status_error) {
+                traversal_errors.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+
+            if (std::filesystem::is_directory(entry_status)) {
+                std::string subdirectory_path = directory_cursor->path().string();
+                if (!is_excluded_directory(subdirectory_path)) {
+                    if (incremental_session != nullptr) {
+                        directory_record.subdirectory_names.push_back(directory_cursor->path().filename().string());
+                    }
+                    discovered_subdirectories.push_back(std::move(subdirectory_path));
+                }
+            } else if (std::filesystem::is_regular_file(entry_status)) {
+                append_packed_filename(directory_batch.packed_filename_buffer, directory_cursor->path().filename().string());
+                directory_batch.filename_count++;
+            }
+        }
+
+        // Register subdirectories before this directory is retired to keep termination exact
+        listing_permit.set_operation_units(directory_batch.filename_count + discovered_subdirectories.size());
+        queue_subdirectories(worker_index, discovered_subdirectories);
+
+        if (metadata_collection_enabled && directory_batch.filename_count > 0) {
+            collect_batch_metadata(worker_index, directory_batch);
+        }
+        if (incremental_session != nullptr) {
+            suppress_unchanged_files(directory_batch, previous_record, directory_record);
+            incremental_session->updated_index.store_directory_record(directory_path, std::move(directory_record));
+        }
+        files_discovered.fetch_add(directory_batch.filename_count, std::memory_order_relaxed);
+        directories_visited.fetch_add(1, std::memory_order_relaxed);
+        listing_permit.complete();  // Downstream back-pressure is not device latency
+        ARTLEST_END_STAGE(walk_timer);
+        if (directory_batch.filename_count > 0) {
+            directory_batch.discovery_timestamp = std::chrono::steady_clock::now();
+            batch_callback(std::move(directory_batch));
+        }
+    }
+
+    bool is_excluded_directory(const std::string& directory_path) const {
+        return !excluded_directory_paths.empty() && excluded_directory_paths.count(directory_path) != 0;
+    }
+
+    void queue_subdirectories(int worker_index, std::vector<std::string>& discovered_subdirectories) {
+        if (discovered_subdirectories.empty()) return;
+        outstanding_directory_count.fetch_add(discovered_subdirectories.size());
+        worker_directory_queue& local_queue = worker_queue_collection[worker_index];
+        std::lock_guard<std::mutex> queue_guard(local_queue.queue_lock);
+        for (auto& subdirectory_path : discovered_subdirectories) {
+            local_queue.pending_directories.push_back(std::move(subdirectory_path));
+        }
+    }
+
+    // Descend into the recorded subdirectories of an unchanged directory and carry its record forward
+    void reuse_unchanged_directory(int worker_index, const std::string& directory_path, const indexed_directory_record& previous_record) {
+        std::vector<std::string> recorded_subdirectories;
+        for (const std::string& subdirectory_name : previous_record.subdirectory_names) {
+            std::string subdirectory_path = (std::filesystem::path(directory_path) / subdirectory_name).string();
+            if (!is_excluded_directory(subdirectory_path)) recorded_subdirectories.push_back(std::move(subdirectory_path));
+        }
+        queue_subdirectories(worker_index, recorded_subdirectories);
+        
+        indexed_directory_record carried_record = previous_record;
+        incremental_session->updated_index.store_directory_record(directory_path, std::move(carried_record));
+        directories_skipped.fetch_add(1, std::memory_order_relaxed);
+        files_unchanged.fetch_add(previous_record.file_records.size(), std::memory_order_relaxed);
+    }
+
+    /**
+     * suppress_unchanged_files - Drops files the previous run already handled
+     * Unchanged files stay recorded; published files are recorded too unless
+     * they are about to be moved, in which case the directory is flagged
+     * revalidation_required and saved as unverified so the next run lists it again
+     */
+    void suppress_unchanged_files(discovered_directory_batch& directory_batch, const indexed_directory_record* previous_record,
+                                  indexed_directory_record& directory_record) {
+        std::unordered_map<std::string_view, const indexed_file_record*> previous_files;
+        if (previous_record != nullptr) {
+            previous_files.reserve(previous_record->file_records.size());
+            for (const indexed_file_record& file_record : previous_record->file_records) {
+                previous_files.emplace(file_record.filename, &file_record);
+            }
+        }
+        
+        std::string published_filenames;
+        std::vector<file_metadata_record> published_metadata;
+        std::string_view packed_filenames = directory_batch.packed_filename_buffer;
+        for (size_t name_index = 0; !packed_filenames.empty(); ++name_index) {
+            size_t separator_position = packed_filenames.find(PACKED_FILENAME_SEPARATOR);
+            std::string_view current_filename = packed_filenames.substr(0, separator_position);
+            packed_filenames.remove_prefix(separator_position + 1);
+            const file_metadata_record& metadata_record = directory_batch.metadata_collection[name_index];
+            
+            auto previous_position = previous_files.find(current_filename);
+            bool file_unchanged = metadata_record.metadata_valid && previous_position != previous_files.end() &&
+                                  previous_position->second->inode_number == metadata_record.inode_number &&
+                                  previous_position->second->modification_time_nanoseconds == metadata_record.modification_time_nanoseconds &&
+                                  previous_position->second->file_size_bytes == metadata_record.file_size_bytes;
+            if (metadata_record.metadata_valid && (file_unchanged || !incremental_session->file_moves_enabled)) {
+                directory_record.file_records.push_back({std::string(current_filename), metadata_record.inode_number,
+                                                         metadata_record.modification_time_nanoseconds, metadata_record.file_size_bytes});
+            }
+            if (file_unchanged) {
+                files_unchanged.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+            append_packed_filename(published_filenames, current_filename);
+            published_metadata.push_back(metadata_record);
+        }
+        
+        if (incremental_session->file_moves_enabled && !published_metadata.empty()) directory_record.revalidation_required = true;
+        directory_batch.packed_filename_buffer.swap(published_filenames);
+        directory_batch.metadata_collection.swap(published_metadata);
+        directory_batch.filename_count = directory_batch.metadata_collection.size();
+    }
+
+    // Fill metadata_collection for every name in the batch with one stat per file
+    void collect_batch_metadata(int worker_index, discovered_directory_batch& directory_batch) {
+        std::vector<const char*> filename_pointers;
+        filename_pointers.reserve(directory_batch.filename_count);
+        const std::string& packed_filename_buffer = directory_batch.packed_filename_buffer;
+        for (size_t name_start = 0; name_start < packed_filename_buffer.size();
+             name_start = packed_filename_buffer.find(PACKED_FILENAME_SEPARATOR, name_start) + 1) {
+            filename_pointers.push_back(packed_filename_buffer.data() + name_start);
+        }
+        directory_batch.metadata_collection.assign(filename_pointers.size(), file_metadata_record());
+        
+#if defined(ARTLEST_POSIX_FILE_OPERATIONS)
+        int directory_descriptor = open(directory_batch.directory_path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (directory_descriptor < 0) {
+            traversal_errors.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+#if defined(ARTLEST_IO_URING_AVAILABLE)
+        if (io_uring_preferred && collect_batch_metadata_with_io_uring(worker_index, directory_descriptor,
+                                                                       filename_pointers, directory_batch.metadata_collection)) {
+            close(directory_descriptor);
+            return;
+        }
+#endif
+        (void)worker_index;
+        for (size_t name_index = 0; name_index < filename_pointers.size(); ++name_index) {
+            struct stat file_status;
+            if (fstatat(directory_descriptor, filename_pointers[name_index], &file_status, AT_SYMLINK_NOFOLLOW) != 0) continue;
+            file_metadata_record& metadata_record = directory_batch.metadata_collection[name_index];
+            metadata_record.file_size_bytes = static_cast<uint64_t>(file_status.st_size);
+            metadata_record.inode_number = static_cast<uint64_t>(file_status.st_ino);
+            metadata_record.device_identifier = static_cast<uint64_t>(file_status.st_dev);
+#if defined(__linux__)
+            metadata_record.modification_time_nanoseconds =
+                static_cast<int64_t>(file_status.st_mtim.tv_sec) * 1000000000 + file_status.st_mtim.tv_nsec;
+#else
+            metadata_record.modification_time_nanoseconds = static_cast<int64_t>(file_status.st_mtime) * 1000000000;
+#endif
+            metadata_record.metadata_valid = true;
+        }
+        close(directory_descriptor);
+#else
+        (void)worker_index;
+        for (size_t name_index = 0; name_index < filename_pointers.size(); ++name_index) {
+            std::error_code status_error;
+            std::filesystem::path file_path = std::filesystem::path(directory_batch.directory_path) / filename_pointers[name_index];
+            uintmax_t file_size = std::filesystem::file_size(file_path, status_error);
+            if (status_error) continue;
+            directory_batch.metadata_collection[name_index].file_size_bytes = file_size;
+            directory_batch.metadata_collection[name_index].metadata_valid = true;
+        }
+#endif
+    }
+
+#if defined(ARTLEST_IO_URING_AVAILABLE)
+    // Submit one IORING_OP_STATX per name; returns false when the ring is unusable
+    bool collect_batch_metadata_with_io_uring(int worker_index, int directory_descriptor,
+                                              const std::vector<const char*>& filename_pointers,
+                                              std::vector<file_metadata_record>& metadata_collection) {
+        worker_directory_queue& worker_queue = worker_queue_collection[worker_index];
+        if (!worker_queue.metadata_ring && !worker_queue.metadata_ring_unavailable) {
+            worker_queue.metadata_ring = create_io_uring_instance({IORING_OP_STATX});
+            worker_queue.metadata_ring_unavailable = !worker_queue.metadata_ring;
+            if (worker_queue.metadata_ring) io_uring_metadata_in_use.store(true);
+        }
+        if (!worker_queue.metadata_ring) return false;
+        
+        std::vector<struct statx> statx_results(filename_pointers.size());
+        bool ring_usable = worker_queue.metadata_ring->execute_operation_batch(filename_pointers.size(),
+            [&](size_t name_index, io_uring_sqe* submission_entry) {
+                submission_entry->opcode = IORING_OP_STATX;
+                submission_entry->fd = directory_descriptor;
+                submission_entry->addr = reinterpret_cast<uint64_t>(filename_pointers[name_index]);
+                submission_entry->len = STATX_SIZE | STATX_INO | STATX_MTIME;
+                submission_entry->statx_flags = AT_SYMLINK_NOFOLLOW;
+                submission_entry->off = reinterpret_cast<uint64_t>(&statx_results[name_index]);
+            },
+            [&](size_t name_index, int operation_result) {
+                if (operation_result < 0) return;
+                const struct statx& statx_result = statx_results[name_index];
+                file_metadata_record& metadata_record = metadata_collection[name_index];
+                metadata_record.file_size_bytes = statx_result.stx_size;
+                metadata_record.inode_number = statx_result.stx_ino;
+                metadata_record.device_identifier = makedev(statx_result.stx_dev_major, statx_result.stx_dev_minor);
+                metadata_record.modification_time_nanoseconds =
+                    static_cast<int64_t>(statx_result.stx_mtime.tv_sec) * 1000000000 + statx_result.stx_mtime.tv_nsec;
+                metadata_record.metadata_valid = true;
+            });
+        if (!ring_usable) {
+            worker_queue.metadata_ring.reset();  // Unsubmitted requests remain queued in the broken ring
+            worker_queue.metadata_ring_unavailable = true;
+        }
+        return ring_usable;
+    }
+#endif
+
+    // Worker main loop: drain own queue, steal when empty, exit once the tree is exhausted
+    void execute_worker_traversal_loop(int worker_index, const directory_batch_callback& batch_callback) {
+        std::string directory_path;
+        int idle_round_counter = 0;
+
+        while (outstanding_directory_count.load() > 0) {
+            if (acquire_local_directory(worker_index, directory_path) || steal_peer_directory(worker_index, directory_path)) {
+                process_directory(worker_index, directory_path, batch_callback);
+                outstanding_directory_count.fetch_sub(1);
+                idle_round_counter = 0;
+                continue;
+            }
+
+            // Back off progressively while peers are still expanding their subtrees
+            if (++idle_round_counter < 64) {
+                std::this_thread::yield();
+            } else {
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }
+        }
+    }
+
+    int worker_thread_count;                                   // Number of traversal workers
+    std::vector<worker_directory_queue> worker_queue_collection;  // One work-stealing queue per worker
+    std::unordered_set<std::string> excluded_directory_paths;  // Canonical subtrees never entered
+    bool metadata_collection_enabled = false;                  // Stat every published file
+    bool io_uring_preferred = false;                           // Batch stat calls through io_uring
+    bool adaptive_concurrency_requested = false;               // Bound active listings by observed latency
+    std::unique_ptr<adaptive_concurrency_limiter> walk_concurrency_limiter;  // Created per traversal when requested
+    incremental_index_session* incremental_session = nullptr;  // Previous/next index (null when not incremental)
+    std::atomic<size_t> directories_skipped{0};                // Directories reused from the previous index
+    std::atomic<size_t> files_unchanged{0};                    // Files suppressed as already handled
+    std::atomic<bool> io_uring_metadata_in_use{false};         // At least one worker runs an io_uring ring
+    std::atomic<size_t> outstanding_directory_count{0};        // Directories queued or in progress
+    std::atomic<size_t> directories_visited{0};                // Directories successfully enumerated
+    std::atomic<size_t> files_discovered{0};                   // Regular files published so far
+    std::atomic<size_t> traversal_errors{0};                   // Unreadable directories or entries
+};
+
+/**
+ * display_progress_indicator - Renders processing progress visualization
+ * This function implements progress bar rendering for real-time feedback
+ * during file processing operations in console environments
+ */
+void display_progress_indicator(int current_iteration, int total_iterations) {
+    // Calculate completion percentage for progress tracking
+    double completion_percentage = (static_cast<double>(current_iteration) / total_iterations) * 100.0;
+    
+    // Determine progress bar fill length based on completion status
+    int progress_bar_length = 40;
+    int filled_segments = static_cast<int>((completion_percentage / 100.0) * progress_bar_length);
+    
+    // Render progress bar with visual indicators into one buffer and write it at once
+    std::string progress_frame = "\rProcessing Progress: [";
+    for (int segment_index = 0; segment_index < progress_bar_length; ++segment_index) {
+        if (segment_index < filled_segments) {
+            progress_frame += "█";  // Filled segment character
+        } else {
+            progress_frame += "░";  // Empty segment character
+        }
+    }
+    std::cout << progress_frame << "] " << std::fixed << std::setprecision(1) << completion_percentage << "%";
+    std::cout.flush();
+}
+
+/**
+ * classification_statistics_accumulator - Running distribution counters
+ * This structure collects category and priority distributions incrementally so
+ * that the streaming pipeline can report statistics without retaining entries
+ */
+struct alignas(64) classification_statistics_accumulator {
+    long long category_distribution_metrics[CLASSIFICATION_CATEGORY_COUNT] = {};  // Files per category
+    long long priority_level_distribution[MAXIMUM_PRIORITY_LEVEL + 1] = {};      // Files per priority level
+    long long total_files_processed = 0;                                        // Files recorded so far
+    unsigned long long total_bytes_observed = 0;                                // Sizes from collected metadata
+    long long content_sniffed_files = 0;                                        // Extension misses read for magic numbers
+    long long content_reclassified_files = 0;                                   // Misses a signature matched
+    
+    // Increment distribution counters for one classified entry
+    void record_classified_entry(const file_classification_entry& file_entry) {
+        category_distribution_metrics[file_entry.category_identifier]++;
+        priority_level_distribution[file_entry.processing_priority]++;
+        total_files_processed++;
+        total_bytes_observed += file_entry.file_size_bytes;
+    }
+    
+    // Fold another accumulator's counters into this one
+    void merge_statistics(const classification_statistics_accumulator& other_accumulator) {
+        for (int category_index = 0; category_index < CLASSIFICATION_CATEGORY_COUNT; ++category_index) {
+            category_distribution_metrics[category_index] += other_accumulator.category_distribution_metrics[category_index];
+        }
+        for (int priority_level = 0; priority_level <= MAXIMUM_PRIORITY_LEVEL; ++priority_level) {
+            priority_level_distribution[priority_level] += other_accumulator.priority_level_distribution[priority_level];
+        }
+        total_files_processed += other_accumulator.total_files_processed;
+        total_bytes_observed += other_accumulator.total_bytes_observed;
+        content_sniffed_files += other_accumulator.content_sniffed_files;
+        content_reclassified_files += other_accumulator.content_reclassified_files;
+    }
+};
+
+/**
+ * published_classification_counters - Live copy of one worker's distribution counters
+ * The owning worker stores its running totals after every batch (single
+ * writer, relaxed stores) and the statistics exporter sums every copy from its
+ * own thread, so sampling never takes a lock a worker could wait on
+ */
+struct alignas(64) published_classification_counters {
+    std::atomic<long long> category_file_counts[CLASSIFICATION_CATEGORY_COUNT] = {};  // Files per category
+    std::atomic<long long> priority_file_counts[MAXIMUM_PRIORITY_LEVEL + 1] = {};     // Files per priority level
+    std::atomic<long long> classified_file_count{0};                                  // Files recorded so far
+    std::atomic<unsigned long long> observed_byte_count{0};                           // Sizes from collected metadata
+    
+    // Replace the published values with the worker's current totals
+    void publish_statistics(const classification_statistics_accumulator& running_totals) {
+        for (int category_index = 0; category_index < CLASSIFICATION_CATEGORY_COUNT; ++category_index) {
+            category_file_counts[category_index].store(running_totals.category_distribution_metrics[category_index],
+                                                       std::memory_order_relaxed);
+        }
+        for (int priority_level = 0; priority_level <= MAXIMUM_PRIORITY_LEVEL; ++priority_level) {
+            priority_file_counts[priority_level].store(running_totals.priority_level_distribution[priority_level],
+                                                       std::memory_order_relaxed);
+        }
+        classified_file_count.store(running_totals.total_files_processed, std::memory_order_relaxed);
+        observed_byte_count.store(running_totals.total_bytes_observed, std::memory_order_relaxed);
+    }
+    
+    // Add the published values to a sample
+    void accumulate_into(classification_statistics_accumulator& sampled_totals) const {
+        for (int category_index = 0; category_index < CLASSIFICATION_CATEGORY_COUNT; ++category_index) {
+            sampled_totals.category_distribution_metrics[category_index] +=
+                category_file_counts[category_index].load(std::memory_order_relaxed);
+        }
+        for (int priority_level = 0; priority_level <= MAXIMUM_PRIORITY_LEVEL; ++priority_level) {
+            sampled_totals.priority_level_distribution[priority_level] +=
+                priority_file_counts[priority_level].load(std::memory_order_relaxed);
+        }
+        sampled_totals.total_files_processed += classified_file_count.load(std::memory_order_relaxed);
+        sampled_totals.total_bytes_observed += observed_byte_count.load(std::memory_order_relaxed);
+    }
+};
+
+/**
+ * classification_result_store - Structure-of-arrays home of collected results
+ * Priority, category and size live in their own dense columns, names and
+ * directories in one NUL-terminated string heap addressed by offset, so the
+ * sort and the statistics pass stream through one or two byte columns
+ * instead of whole entries. Consecutive entries of one directory share a
+ * directory table slot. Entries are rebuilt on demand as views into the heap
+ * (valid until the store is modified again)
+ */
+class classification_result_store {
+public:
+    using entry_chunk_consumer = std::function<void(const file_classification_entry*, size_t)>;
+
+    size_t size() const { return priority_column.size(); }
+    bool empty() const { return priority_column.empty(); }
+    size_t heap_byte_count() const { return string_heap.size(); }
+    size_t column_byte_count() const {
+        return size() * (2 * sizeof(uint8_t) + sizeof(uint64_t) + sizeof(uint64_t) + 2 * sizeof(uint32_t)) +
+               directory_offsets.size() * (sizeof(uint64_t) + sizeof(uint32_t));
+    }
+
+    // Grow columns and heap ahead of demand from a projected final entry count
+    void reserve_ahead(size_t projected_entry_count, size_t incoming_entry_count) {
+        size_t required_capacity = size() + incoming_entry_count;
+        size_t estimated_entry_count = std::max(projected_entry_count, required_capacity);
+        if (!empty()) {
+            size_t average_entry_bytes = string_heap.size() / size() + 1;
+            if (estimated_entry_count * average_entry_bytes > string_heap.capacity()) {
+                string_heap.reserve(estimated_entry_count * average_entry_bytes);
+            }
+        }
+        if (required_capacity > priority_column.capacity()) {
+            size_t reserved_entry_count = estimated_entry_count + estimated_entry_count / 8;
+            priority_column.reserve(reserved_entry_count);
+            category_column.reserve(reserved_entry_count);
+            file_size_column.reserve(reserved_entry_count);
+            filename_offset_column.reserve(reserved_entry_count);
+            filename_length_column.reserve(reserved_entry_count);
+            directory_index_column.reserve(reserved_entry_count);
+        }
+    }
+
+    // Copy entries (and their strings) into the columns
+    void append_entries(const file_classification_entry* entry_collection, size_t entry_count) {
+        for (size_t entry_index = 0; entry_index < entry_count; ++entry_index) {
+            const file_classification_entry& current_entry = entry_collection[entry_index];
+            if (directory_offsets.empty() || current_entry.source_directory_path != directory_at(directory_offsets.size() - 1)) {
+                directory_offsets.push_back(store_heap_string(current_entry.source_directory_path));
+                directory_lengths.push_back(static_cast<uint32_t>(current_entry.source_directory_path.size()));
+            }
+            priority_column.push_back(current_entry.processing_priority);
+            category_column.push_back(current_entry.category_identifier);
+            file_size_column.push_back(current_entry.file_size_bytes);
+            filename_offset_column.push_back(store_heap_string(current_entry.filename_identifier));
+            filename_length_column.push_back(static_cast<uint32_t>(current_entry.filename_identifier.size()));
+            directory_index_column.push_back(static_cast<uint32_t>(directory_offsets.size() - 1));
+        }
+    }
+
+    // Move another store's rows to the end of this one, rebasing heap offsets and directory indices
+    void append_store(classification_result_store&& other_store) {
+        uint64_t heap_base = string_heap.size();
+        uint32_t directory_base = static_cast<uint32_t>(directory_offsets.size());
+        string_heap.append(other_store.string_heap);
+        priority_column.insert(priority_column.end(), other_store.priority_column.begin(), other_store.priority_column.end());
+        category_column.insert(category_column.end(), other_store.category_column.begin(), other_store.category_column.end());
+        file_size_column.insert(file_size_column.end(), other_store.file_size_column.begin(), other_store.file_size_column.end());
+        filename_length_column.insert(filename_length_column.end(), other_store.filename_length_column.begin(),
+                                      other_store.filename_length_column.end());
+        directory_lengths.insert(directory_lengths.end(), other_store.directory_lengths.begin(), other_store.directory_lengths.end());
+        for (uint64_t filename_offset : other_store.filename_offset_column) filename_offset_column.push_back(heap_base + filename_offset);
+        for (uint64_t directory_offset : other_store.directory_offsets) directory_offsets.push_back(heap_base + directory_offset);
+        for (uint32_t directory_index : other_store.directory_index_column) directory_index_column.push_back(directory_base + directory_index);
+        other_store = classification_result_store();
+    }
+
+    file_classification_entry entry_at(size_t entry_index) const {
+        file_classification_entry stored_entry;
+        stored_entry.filename_identifier = std::string_view(string_heap.data() + filename_offset_column[entry_index],
+                                                            filename_length_column[entry_index]);
+        stored_entry.source_directory_path = directory_at(directory_index_column[entry_index]);
+        stored_entry.file_size_bytes = file_size_column[entry_index];
+        stored_entry.category_identifier = static_cast<classification_category_identifier>(category_column[entry_index]);
+        stored_entry.processing_priority = priority_column[entry_index];
+        return stored_entry;
+    }
+
+    /**
+     * sort_by_processing_priority - Stable counting sort driven by the priority column
+     * The histogram reads one byte per entry; every other column is then
+     * scattered once through the shared destination positions. Entries keep
+     * their collection order within a level, so directory runs stay together
+     */
+    void sort_by_processing_priority() {
+        size_t level_counts[MAXIMUM_PRIORITY_LEVEL + 1] = {};
+        histogram_byte_column(priority_column, level_counts, MAXIMUM_PRIORITY_LEVEL + 1);
+        size_t level_offsets[MAXIMUM_PRIORITY_LEVEL + 1];
+        size_t running_offset = 0;
+        for (int priority_level = 0; priority_level <= MAXIMUM_PRIORITY_LEVEL; ++priority_level) {
+            level_offsets[priority_level] = running_offset;
+            running_offset += level_counts[priority_level];
+        }
+        
+        std::vector<size_t> destination_positions(size());
+        for (size_t entry_index = 0; entry_index < size(); ++entry_index) {
+            destination_positions[entry_index] = level_offsets[priority_column[entry_index]]++;
+        }
+        scatter_column(category_column, destination_positions);
+        scatter_column(file_size_column, destination_positions);
+        scatter_column(filename_offset_column, destination_positions);
+        scatter_column(filename_length_column, destination_positions);
+        scatter_column(directory_index_column, destination_positions);
+        
+        // The sorted priority column is just each level repeated its count
+        size_t fill_position = 0;
+        for (int priority_level = 0; priority_level <= MAXIMUM_PRIORITY_LEVEL; ++priority_level) {
+            std::fill_n(priority_column.begin() + fill_position, level_counts[priority_level], static_cast<uint8_t>(priority_level));
+            fill_position += level_counts[priority_level];
+        }
+    }
+
+    // Category, priority and byte totals from column scans only
+    void accumulate_statistics(classification_statistics_accumulator& statistics_accumulator) const {
+        size_t category_counts[CLASSIFICATION_CATEGORY_COUNT] = {};
+        size_t level_counts[MAXIMUM_PRIORITY_LEVEL + 1] = {};
+        histogram_byte_column(category_column, category_counts, CLASSIFICATION_CATEGORY_COUNT);
+        histogram_byte_column(priority_column, level_counts, MAXIMUM_PRIORITY_LEVEL + 1);
+        unsigned long long total_bytes = 0;
+        for (uint64_t file_size : file_size_column) total_bytes += file_size;  // Contiguous sum; vectorizes
+        for (int category_index = 0; category_index < CLASSIFICATION_CATEGORY_COUNT; ++category_index) {
+            statistics_accumulator.category_distribution_metrics[category_index] += static_cast<long long>(category_counts[category_index]);
+        }
+        for (int priority_level = 0; priority_level <= MAXIMUM_PRIORITY_LEVEL; ++priority_level) {
+            statistics_accumulator.priority_level_distribution[priority_level] += static_cast<long long>(level_counts[priority_level]);
+        }
+        statistics_accumulator.total_files_processed += static_cast<long long>(size());
+        statistics_accumulator.total_bytes_observed += total_bytes;
+    }
+
+    // Hand rows to a consumer in bounded chunks of rebuilt entries
+    void for_each_entry_chunk(const entry_chunk_consumer& chunk_consumer) const {
+        std::vector<file_classification_entry> chunk_entries;
+        chunk_entries.reserve(std::min(size(), RESULT_STORE_CHUNK_SIZE));
+        for (size_t chunk_start = 0; chunk_start < size(); chunk_start += RESULT_STORE_CHUNK_SIZE) {
+            size_t chunk_end = std::min(size(), chunk_start + RESULT_STORE_CHUNK_SIZE);
+            chunk_entries.clear();
+            for (size_t entry_index = chunk_start; entry_index < chunk_end; ++entry_index) chunk_entries.push_back(entry_at(entry_index));
+            chunk_consumer(chunk_entries.data(), chunk_entries.size());
+        }
+    }
+
+    // Every row as an entry, for passes that need random access or per-entry flags
+    std::vector<file_classification_entry> materialize_entries() const {
+        std::vector<file_classification_entry> materialized_entries;
+        materialized_entries.reserve(size());
+        for (size_t entry_index = 0; entry_index < size(); ++entry_index) materialized_entries.push_back(entry_at(entry_index));
+        return materialized_entries;
+    }
+
+private:
+    uint64_t store_heap_string(std::string_view source_text) {
+        uint64_t heap_offset = string_heap.size();
+        string_heap.append(source_text);
+        string_heap.push_back('\0');
+        return heap_offset;
+    }
+
+    std::string_view directory_at(size_t directory_index) const {
+        return std::string_view(string_heap.data() + directory_offsets[directory_index], directory_lengths[directory_index]);
+    }
+
+    // Four interleaved sub-histograms so consecutive equal bytes do not serialize on one counter
+    static void histogram_byte_column(const std::vector<uint8_t>& byte_column, size_t* bucket_counts, size_t bucket_count) {
+        uint32_t partial_counts[4][256] = {};
+        size_t value_index = 0;
+        size_t column_length = byte_column.size();
+        while (value_index < column_length) {
+            // Flush before any 32-bit sub-counter could overflow
+            size_t block_end = std::min(column_length, value_index + (size_t(1) << 30));
+            for (; value_index + 4 <= block_end; value_index += 4) {
+                partial_counts[0][byte_column[value_index]]++;
+                partial_counts[1][byte_column[value_index + 1]]++;
+                partial_counts[2][byte_column[value_index + 2]]++;
+                partial_counts[3][byte_column[value_index + 3]]++;
+            }
+            for (; value_index < block_end; ++value_index) partial_counts[0][byte_column[value_index]]++;
+            for (size_t bucket_index = 0; bucket_index < bucket_count; ++bucket_index) {
+                bucket_counts[bucket_index] += size_t(partial_counts[0][bucket_index]) + partial_counts[1][bucket_index] +
+                                               partial_counts[2][bucket_index] + partial_counts[3][bucket_index];
+            }
+            std::memset(partial_counts, 0, sizeof(partial_counts));
+        }
+    }
+
+    template <typename column_value_type>
+    static void scatter_column(std::vector<column_value_type>& value_column, const std::vector<size_t>& destination_positions) {
+        std::vector<column_value_type> sorted_column(value_column.size());
+        for (size_t entry_index = 0; entry_index < value_column.size(); ++entry_index) {
+            sorted_column[destination_positions[entry_index]] = value_column[entry_index];
+        }
+        value_column.swap(sorted_column);
+    }
+
+    std::vector<uint8_t> priority_column;      // Processing priority per row
+    std::vector<uint8_t> category_column;      // classification_category_identifier per row
+    std::vector<uint64_t> file_size_column;    // Size per row (0 without metadata)
+    std::vector<uint64_t> filename_offset_column;  // Heap offset of each row's name
+    std::vector<uint32_t> filename_length_column;  // Name length per row
+    std::vector<uint32_t> directory_index_column;  // Directory table slot per row
+    std::vector<uint64_t> directory_offsets;   // Heap offset of each directory path
+    std::vector<uint32_t> directory_lengths;   // Length of each directory path
+    std::string string_heap;                   // NUL-terminated names and directories
+};
+
+/**
+ * classification_worker_state - Private output of one classification worker
+ * Each worker owns its histograms and result columns outright, and
+ * the structure is cache-line aligned so neighbouring workers never write to
+ * the same line; results are reduced once after all workers have finished
+ */
+struct alignas(64) classification_worker_state {
+    classification_statistics_accumulator statistics_accumulator;  // Non-shared category/priority histograms
+    classification_result_store result_store;                      // Entries classified by this worker
+    std::vector<file_classification_entry> batch_entries;          // Scratch entries of the batch being classified
+    alignas(64) std::atomic<size_t> progress_counter{0};          // Files classified, sampled by progress display
+    published_classification_counters published_statistics;       // Live distributions, sampled by the statistics exporter
+};
+
+/**
+ * display_statistical_analysis_report - Presents accumulated processing statistics
+ * This function renders the category and priority distribution tables from
+ * previously accumulated counters, plus the measured extension match rate and
+ * classification throughput (when the elapsed time was measured)
+ */
+void display_statistical_analysis_report(const classification_statistics_accumulator& statistics_accumulator,
+                                         double classification_elapsed_seconds) {
+    ARTLEST_TIME_STAGE(STAGE_REPORT);
+    const long long* category_distribution_metrics = statistics_accumulator.category_distribution_metrics;
+    const long long* priority_level_distribution = statistics_accumulator.priority_level_distribution;
+    long long total_files_processed = statistics_accumulator.total_files_processed;
+    
+    // Display comprehensive statistical analysis header
+    std::cout << "\n\n╔══════════════════════════════════════════════════════════════╗\n";
+    std::cout << "║                    STATISTICAL ANALYSIS REPORT               ║\n";
+    std::cout << "╠══════════════════════════════════════════════════════════════╣\n";
+    
+    // Present total processing metrics
+    std::cout << "║ Total Files Processed: " << std::setw(32) << total_files_processed << " ║\n";
+    long long extension_matched_files = total_files_processed - category_distribution_metrics[CATEGORY_MISCELLANEOUS_FILES];
+    std::ostringstream match_rate_text;
+    match_rate_text << std::fixed << std::setprecision(1)
+                    << (total_files_processed > 0 ? 100.0 * extension_matched_files / total_files_processed : 0.0) << "%";
+    std::cout << "║ Extension Match Rate: " << std::setw(31) << match_rate_text.str() << " ║\n";
+    if (classification_elapsed_seconds > 0.0 && total_files_processed > 0) {
+        std::ostringstream throughput_text;
+        throughput_text << std::fixed << std::setprecision(0) << total_files_processed / classification_elapsed_seconds << " files/s";
+        std::cout << "║ Classification Throughput: " << std::setw(26) << throughput_text.str() << " ║\n";
+    }
+    if (statistics_accumulator.total_bytes_observed > 0) {
+        std::cout << "║ Total Bytes Observed: " << std::setw(33) << statistics_accumulator.total_bytes_observed << " ║\n";
+    }
+    if (statistics_accumulator.content_sniffed_files > 0) {
+        std::string sniffing_summary = std::to_string(statistics_accumulator.content_sniffed_files) + " (" +
+                                       std::to_string(statistics_accumulator.content_reclassified_files) + " matched)";
+        std::cout << "║ Content Sniffed: " << std::setw(38) << sniffing_summary << " ║\n";
+    }
+    std::cout << "╠══════════════════════════════════════════════════════════════╣\n";
+    
+    // Display category distribution analysis
+    std::cout << "║                  CATEGORY DISTRIBUTION                       ║\n";
+    std::cout << "╠══════════════════════════════════════════════════════════════╣\n";
+    
+    for (int category_index = 0; category_index < CLASSIFICATION_CATEGORY_COUNT; ++category_index) {
+        if (category_distribution_metrics[category_index] == 0) continue;
+        double percentage = (static_cast<double>(category_distribution_metrics[category_index]) / total_files_processed) * 100.0;
+        std::cout << "║ " << std::left << std::setw(25) << CLASSIFICATION_CATEGORY_TABLE[category_index].directory_name 
+                  << ": " << std::right << std::setw(3) << category_distribution_metrics[category_index] 
+                  << " files (" << std::fixed << std::setprecision(1) << percentage << "%) ║\n";
+    }
+    
+    // Display priority level distribution analysis
+    std::cout << "╠══════════════════════════════════════════════════════════════╣\n";
+    std::cout << "║                  PRIORITY DISTRIBUTION                       ║\n";
+    std::cout << "╠══════════════════════════════════════════════════════════════╣\n";
+    
+    for (int priority_level = 1; priority_level <= MAXIMUM_PRIORITY_LEVEL; ++priority_level) {
+        if (priority_level_distribution[priority_level] == 0) continue;
+        double percentage = (static_cast<double>(priority_level_distribution[priority_level]) / total_files_processed) * 100.0;
+        std::cout << "║ Priority Level " << priority_level 
+                  << ": " << std::right << std::setw(3) << priority_level_distribution[priority_level] 
+                  << " files (" << std::fixed << std::setprecision(1) << percentage << "%) ║\n";
+    }
+    
+    std::cout << "╚══════════════════════════════════════════════════════════════╝\n";
+}
+
+/**
+ * perform_statistical_analysis - Calculates processing metrics and statistics
+ * This function reduces the per-worker histograms into one set of totals,
+ * presents the comprehensive analysis of file processing results (unless the
+ * run is quiet) and returns the totals (e.g. for a shard report)
+ */
+classification_statistics_accumulator perform_statistical_analysis(const execution_configuration_parameters& runtime_configuration,
+                                                                   const std::vector<classification_worker_state>& worker_states,
+                                                                   double classification_elapsed_seconds,
+                                                                   const classification_result_store* result_store = nullptr) {
+    // Reduce private worker histograms once, after classification has finished;
+    // collected results contribute their distributions by scanning store columns
+    classification_statistics_accumulator statistics_accumulator;
+    for (const classification_worker_state& worker_state : worker_states) {
+        statistics_accumulator.merge_statistics(worker_state.statistics_accumulator);
+    }
+    if (result_store != nullptr) result_store->accumulate_statistics(statistics_accumulator);
+    
+    if (!runtime_configuration.quiet_mode_enabled) {
+        display_statistical_analysis_report(statistics_accumulator, classification_elapsed_seconds);
+    }
+    return statistics_accumulator;
+}
+
+/**
+ * display_traversal_progress - Renders running counters for filesystem ingestion
+ * This function reports classification progress when the total file count is
+ * unknown because files are classified while the directory walk is still running
+ */
+void display_traversal_progress(size_t files_classified, size_t directories_received) {
+    std::cout << "\rFiles Classified: " << files_classified
+              << " | Directories Received: " << directories_received;
+    std::cout.flush();
+}
+
+/**
+ * rate_limited_progress_reporter - Draws progress from its own thread
+ * The frame renderer samples counters the workers publish and is invoked
+ * PROGRESS_UPDATE_INTERVAL times per second, so processing loops only bump
+ * an atomic and never touch stdout. Reporting is disabled entirely when
+ * stdout is not a terminal or the caller turns it off (--quiet), so no thread
+ * is started for it
+ */
+class rate_limited_progress_reporter {
+public:
+    rate_limited_progress_reporter(std::function<void()> frame_renderer, bool reporting_enabled)
+        : render_frame(std::move(frame_renderer)) {
+        if (!reporting_enabled || !standard_output_is_terminal()) return;
+        reporter_thread = std::thread([this] {
+            std::unique_lock<std::mutex> reporter_guard(reporter_lock);
+            while (!stop_requested) {
+                render_frame();
+                stop_signal.wait_for(reporter_guard, std::chrono::milliseconds(1000 / PROGRESS_UPDATE_INTERVAL),
+                                     [this] { return stop_requested; });
+            }
+        });
+    }
+
+    ~rate_limited_progress_reporter() { stop_reporting(); }
+
+    rate_limited_progress_reporter(const rate_limited_progress_reporter&) = delete;
+    rate_limited_progress_reporter& operator=(const rate_limited_progress_reporter&) = delete;
+
+    // Stop the thread and draw one last frame so the display ends at the final value
+    void stop_reporting() {
+        if (!reporter_thread.joinable()) return;
+        {
+            std::lock_guard<std::mutex> reporter_guard(reporter_lock);
+            stop_requested = true;
+        }
+        stop_signal.notify_one();
+        reporter_thread.join();
+        render_frame();
+    }
+
+    static bool standard_output_is_terminal() {
+#if defined(ARTLEST_POSIX_FILE_OPERATIONS)
+        return isatty(STDOUT_FILENO) != 0;
+#elif defined(_WIN32)
+        return _isatty(_fileno(stdout)) != 0;
+#else
+        return true;
+#endif
+    }
+
+private:
+    std::function<void()> render_frame;       // Samples counters and draws one frame
+    bool stop_requested = false;              // Guarded by reporter_lock
+    std::mutex reporter_lock;
+    std::condition_variable stop_signal;      // Wakes the reporter early on shutdown
+    std::thread reporter_thread;
+};
+
+/**
+ * display_move_statistics - Summarizes what the file moving executor did
+ */
+void display_move_statistics(const file_move_statistics& executor_statistics) {
+    std::cout << "\nFile Moves: " << executor_statistics.files_renamed << " renamed, "
+              << executor_statistics.files_copied << " copied across devices ("
+              << executor_statistics.bytes_copied << " bytes), "
+              << executor_statistics.collision_renames << " renamed to avoid collisions, "
+              << executor_statistics.failed_moves << " failed\n";
+}
+
+/**
+ * display_move_concurrency - Reports the adaptive limit of each destination device
+ * The io_uring backend bypasses the limits, so they are not reported as if used
+ */
+void display_move_concurrency(const file_move_executor& move_executor) {
+    std::vector<adaptive_concurrency_snapshot> limit_snapshots = move_executor.adaptive_concurrency_snapshots();
+    if (!limit_snapshots.empty() && move_executor.io_uring_backend_active()) {
+        std::cout << "Move Concurrency: adaptive limits not used, the io_uring backend submits each directory run as one batch\n";
+        return;
+    }
+    for (const adaptive_concurrency_snapshot& limit_snapshot : limit_snapshots) {
+        std::cout << "Move Concurrency: device " << limit_snapshot.device_identifier << " adaptive, "
+                  << describe_adaptive_concurrency(limit_snapshot) << "\n";
+    }
+}
+
+/**
+ * display_processing_results_table - Prints the boxed per-entry result rows
+ */
+void display_processing_results_table(const file_classification_entry* entry_collection, size_t entry_count) {
+    ARTLEST_TIME_STAGE(STAGE_REPORT);
+    for (size_t entry_index = 0; entry_index < entry_count; ++entry_index) {
+        const file_classification_entry& processed_entry = entry_collection[entry_index];
+        std::cout << "║ File: " << std::left << std::setw(25) << processed_entry.filename_identifier
+                  << " → " << std::setw(20) << CLASSIFICATION_CATEGORY_TABLE[processed_entry.category_identifier].directory_name
+                  << " [P" << static_cast<int>(processed_entry.processing_priority) << "] ║\n";
+    }
+}
+
+/**
+ * binary_result_file_header - Fixed header of the columnar result file
+ * The file is laid out as header, category name table, then one column per
+ * field (each 8-byte aligned) and finally a heap of NUL-terminated strings.
+ * Readers mmap the file and index the columns directly, without parsing.
+ * Integers are in host byte order; offsets are from the start of the file
+ */
+struct binary_result_file_header {
+    char file_magic[8];                       // "ARTLRES1"
+    uint32_t format_version;                  // Layout revision (1)
+    uint32_t header_size;                     // sizeof(binary_result_file_header)
+    uint64_t entry_count;                     // Rows in every column
+    uint32_t category_count;                  // Entries in the category name table
+    uint32_t reserved_padding;                // Zero
+    uint64_t category_name_offsets_offset;    // uint64[category_count] heap offsets of category names
+    uint64_t file_size_column_offset;         // uint64[entry_count] file sizes (0 without metadata)
+    uint64_t filename_offset_column_offset;   // uint64[entry_count] heap offsets of file names
+    uint64_t directory_offset_column_offset;  // uint64[entry_count] heap offsets of source directories
+    uint64_t filename_length_column_offset;   // uint32[entry_count] file name lengths
+    uint64_t directory_length_column_offset;  // uint32[entry_count] source directory lengths
+    uint64_t category_column_offset;          // uint8[entry_count] classification_category_identifier
+    uint64_t priority_column_offset;          // uint8[entry_count] processing priority
+    uint64_t string_heap_offset;              // Start of the string heap
+    uint64_t string_heap_size;                // Bytes in the string heap
+};
+
+/**
+ * write_binary_result_file - Writes entries as a memory-mappable columnar file
+ * The layout is sized up front so the file can be written through a single
+ * shared mapping; consecutive entries from the same directory share one heap
+ * copy of the directory path. Returns false and fills error_message on failure
+ */
+bool write_binary_result_file(const std::string& output_file_path, const file_classification_entry* entry_collection,
+                              size_t entry_count, std::string& error_message) {
+    ARTLEST_TIME_STAGE(STAGE_REPORT);
+    auto align_offset = [](uint64_t byte_offset) { return (byte_offset + 7) & ~static_cast<uint64_t>(7); };
+    
+    // Size the string heap: category names, every file name, each directory run once
+    uint64_t string_heap_size = 0;
+    for (int category_index = 0; category_index < CLASSIFICATION_CATEGORY_COUNT; ++category_index) {
+        string_heap_size += std::strlen(CLASSIFICATION_CATEGORY_TABLE[category_index].directory_name) + 1;
+    }
+    for (size_t entry_index = 0; entry_index < entry_count; ++entry_index) {
+        const file_classification_entry& current_entry = entry_collection[entry_index];
+        string_heap_size += current_entry.filename_identifier.size() + 1;
+        if (entry_index == 0 || current_entry.source_directory_path != entry_collection[entry_index - 1].source_directory_path) {
+            string_heap_size += current_entry.source_directory_path.size() + 1;
+        }
+    }
+    
+    binary_result_file_header file_header;
+    std::memset(&file_header, 0, sizeof(file_header));
+    std::memcpy(file_header.file_magic, "ARTLRES1", sizeof(file_header.file_magic));
+    file_header.format_version = 1;
+    file_header.header_size = sizeof(binary_result_file_header);
+    file_header.entry_count = entry_count;
+    file_header.category_count = CLASSIFICATION_CATEGORY_COUNT;
+    file_header.category_name_offsets_offset = align_offset(sizeof(binary_result_file_header));
+    file_header.file_size_column_offset = align_offset(file_header.category_name_offsets_offset + CLASSIFICATION_CATEGORY_COUNT * sizeof(uint64_t));
+    file_header.filename_offset_column_offset = align_offset(file_header.file_size_column_offset + entry_count * sizeof(uint64_t));
+    file_header.directory_offset_column_offset = align_offset(file_header.filename_offset_column_offset + entry_count * sizeof(uint64_t));
+    file_header.filename_length_column_offset = align_offset(file_header.directory_offset_column_offset + entry_count * sizeof(uint64_t));
+    file_header.directory_length_column_offset = align_offset(file_header.filename_length_column_offset + entry_count * sizeof(uint32_t));
+    file_header.category_column_offset = align_offset(file_header.directory_length_column_offset + entry_count * sizeof(uint32_t));
+    file_header.priority_column_offset = align_offset(file_header.category_column_offset + entry_count);
+    file_header.string_heap_offset = align_offset(file_header.priority_column_offset + entry_count);
+    file_header.string_heap_size = string_heap_size;
+    uint64_t total_file_size = file_header.string_heap_offset + string_heap_size;
+    
+    // Obtain a writable image of the whole file: a shared mapping where available
+    char* file_image = nullptr;
+#if defined(ARTLEST_POSIX_FILE_OPERATIONS)
+    int output_descriptor = open(output_file_path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (output_descriptor < 0 || ftruncate(output_descriptor, static_cast<off_t>(total_file_size)) != 0) {
+        error_message = std::strerror(errno);
+        if (output_descriptor >= 0) close(output_descriptor);
+        return false;
+    }
+    void* mapped_region = mmap(nullptr, total_file_size, PROT_READ | PROT_WRITE, MAP_SHARED, output_descriptor, 0);
+    if (mapped_region == MAP_FAILED) {
+        error_message = std::strerror(errno);
+        close(output_descriptor);
+        return false;
+    }
+    file_image = static_cast<char*>(mapped_region);
+#else
+    std::vector<char> file_buffer(total_file_size, 0);
+    file_image = file_buffer.data();
+#endif
+    
+    // Fill header, category table, columns and heap in one pass over the entries
+    std::memcpy(file_image, &file_header, sizeof(file_header));
+    char* string_heap = file_image + file_header.string_heap_offset;
+    uint64_t heap_position = 0;
+    auto store_heap_string = [&](std::string_view string_value) {
+        uint64_t string_offset = file_header.string_heap_offset + heap_position;
+        std::memcpy(string_heap + heap_position, string_value.data(), string_value.size());
+        string_heap[heap_position + string_value.size()] = '\0';
+        heap_position += string_value.size() + 1;
+        return string_offset;
+    };
+    uint64_t* category_name_offsets = reinterpret_cast<uint64_t*>(file_image + file_header.category_name_offsets_offset);
+    for (int category_index = 0; category_index < CLASSIFICATION_CATEGORY_COUNT; ++category_index) {
+        category_name_offsets[category_index] = store_heap_string(CLASSIFICATION_CATEGORY_TABLE[category_index].directory_name);
+    }
+    uint64_t* file_size_column = reinterpret_cast<uint64_t*>(file_image + file_header.file_size_column_offset);
+    uint64_t* filename_offset_column = reinterpret_cast<uint64_t*>(file_image + file_header.filename_offset_column_offset);
+    uint64_t* directory_offset_column = reinterpret_cast<uint64_t*>(file_image + file_header.directory_offset_column_offset);
+    uint32_t* filename_length_column = reinterpret_cast<uint32_t*>(file_image + file_header.filename_length_column_offset);
+    uint32_t* directory_length_column = reinterpret_cast<uint32_t*>(file_image + file_header.directory_length_column_offset);
+    uint8_t* category_column = reinterpret_cast<uint8_t*>(file_image + file_header.category_column_offset);
+    uint8_t* priority_column = reinterpret_cast<uint8_t*>(file_image + file_header.priority_column_offset);
+    uint64_t directory_heap_offset = 0;
+    for (size_t entry_index = 0; entry_index < entry_count; ++entry_index) {
+        const file_classification_entry& current_entry = entry_collection[entry_index];
+        if (entry_index == 0 || current_entry.source_directory_path != entry_collection[entry_index - 1].source_directory_path) {
+            directory_heap_offset = store_heap_string(current_entry.source_directory_path);
+        }
+        file_size_column[entry_index] = current_entry.file_size_bytes;
+        filename_offset_column[entry_index] = store_heap_string(current_entry.filename_identifier);
+        directory_offset_column[entry_index] = directory_heap_offset;
+        filename_length_column[entry_index] = static_cast<uint32_t>(current_entry.filename_identifier.size());
+        directory_length_column[entry_index] = static_cast<uint32_t>(current_entry.source_directory_path.size());
+        category_column[entry_index] = current_entry.category_identifier;
+        priority_column[entry_index] = current_entry.processing_priority;
+    }
+    
+#if defined(ARTLEST_POSIX_FILE_OPERATIONS)
+    bool write_succeeded = munmap(mapped_region, total_file_size) == 0;
+    if (close(output_descriptor) != 0) write_succeeded = false;
+    if (!write_succeeded) error_message = std::strerror(errno);
+    return write_succeeded;
+#else
+    std::ofstream output_stream(output_file_path, std::ios::binary | std::ios::trunc);
+    output_stream.write(file_image, static_cast<std::streamsize>(total_file_size));
+    if (!output_stream.flush()) {
+        error_message = "cannot write " + output_file_path;
+        return false;
+    }
+    return true;
+#endif
+}
+
+/**
+ * tsv_result_writer - Line-oriented result output built on bulk buffered writes
+ * Each entry becomes "category<TAB>priority<TAB>size<TAB>directory<TAB>name"
+ * assembled by hand into a large buffer that is written once it fills, so no
+ * stream formatting runs per entry. Tab, newline and backslash inside paths
+ * are escaped as \t, \n and \\ to keep one entry per line
+ */
+class tsv_result_writer {
+public:
+    ~tsv_result_writer() {
+        std::string ignored_error;
+        close_output(ignored_error);
+    }
+
+    bool open_output(const std::string& output_file_path, std::string& error_message) {
+        output_file = std::fopen(output_file_path.c_str(), "wb");
+        if (output_file == nullptr) {
+            error_message = std::strerror(errno);
+            return false;
+        }
+        std::setvbuf(output_file, nullptr, _IONBF, 0);  // Whole buffers are written at once; skip stdio copies
+        output_buffer.reserve(TSV_OUTPUT_BUFFER_SIZE + 4096);
+        output_buffer = "category\tpriority\tsize\tdirectory\tfilename\n";
+        return true;
+    }
+
+    void append_entries(const file_classification_entry* entry_collection, size_t entry_count) {
+        ARTLEST_TIME_STAGE(STAGE_REPORT);
+        for (size_t entry_index = 0; entry_index < entry_count; ++entry_index) {
+            const file_classification_entry& current_entry = entry_collection[entry_index];
+            output_buffer += CLASSIFICATION_CATEGORY_TABLE[current_entry.category_identifier].directory_name;
+            output_buffer += '\t';
+            output_buffer += static_cast<char>('0' + current_entry.processing_priority);
+            output_buffer += '\t';
+            append_decimal(current_entry.file_size_bytes);
+            output_buffer += '\t';
+            append_escaped_field(current_entry.source_directory_path);
+            output_buffer += '\t';
+            append_escaped_field(current_entry.filename_identifier);
+            output_buffer += '\n';
+            if (output_buffer.size() >= TSV_OUTPUT_BUFFER_SIZE) flush_buffer();
+        }
+    }
+
+    // Flush and close; returns false if any write failed
+    bool close_output(std::string& error_message) {
+        if (output_file == nullptr) return true;
+        flush_buffer();
+        if (std::fclose(output_file) != 0) write_failed = true;
+        output_file = nullptr;
+        if (write_failed) error_message = "write error";
+        return !write_failed;
+    }
+
+private:
+    void flush_buffer() {
+        if (!output_buffer.empty() && std::fwrite(output_buffer.data(), 1, output_buffer.size(), output_file) != output_buffer.size()) {
+            write_failed = true;
+        }
+        output_buffer.clear();
+    }
+
+    void append_decimal(uint64_t numeric_value) {
+        char digit_buffer[20];
+        int digit_count = 0;
+        do {
+            digit_buffer[digit_count++] = static_cast<char>('0' + numeric_value % 10);
+            numeric_value /= 10;
+        } while (numeric_value != 0);
+        while (digit_count > 0) output_buffer += digit_buffer[--digit_count];
+    }
+
+    void append_escaped_field(std::string_view field_value) {
+        size_t plain_start = 0;
+        for (size_t character_index = 0; character_index < field_value.size(); ++character_index) {
+            char current_character = field_value[character_index];
+            if (current_character != '\t' && current_character != '\n' && current_character != '\\') continue;
+            output_buffer.append(field_value.data() + plain_start, character_index - plain_start);
+            output_buffer += '\\';
+            output_buffer += current_character == '\t' ? 't' : current_character == '\n' ? 'n' : '\\';
+            plain_start = character_index + 1;
+        }
+        output_buffer.append(field_value.data() + plain_start, field_value.size() - plain_start);
+    }
+
+    std::FILE* output_file = nullptr;         // Destination stream (stdio buffering disabled)
+    std::string output_buffer;                // Pending bytes
+    bool write_failed = false;                // Sticky error flag
+};
+
+/**
+ * display_result_file_summary - Reports where file-based result output went
+ */
+void display_result_file_summary(const execution_configuration_parameters& runtime_configuration, size_t entry_count) {
+    std::cout << "Results Written: " << entry_count << " entries to " << runtime_configuration.output_file_path
+              << (runtime_configuration.output_format == RESULT_OUTPUT_BINARY ? " (binary columnar)\n" : " (TSV)\n");
+}
+
+/**
+ * display_metadata_backend - Reports which system call path collected file metadata
+ */
+void display_metadata_backend(const execution_configuration_parameters& runtime_configuration,
+                              const parallel_directory_walker& directory_walker) {
+    if (!runtime_configuration.metadata_collection_enabled) return;
+    std::cout << "\nMetadata Backend: "
+              << (directory_walker.io_uring_metadata_active() ? "io_uring batched statx" : "synchronous fstatat");
+}
+
+/**
+ * display_walker_concurrency - Reports where the adaptive listing limit settled
+ */
+void display_walker_concurrency(const parallel_directory_walker& directory_walker) {
+    if (!directory_walker.adaptive_concurrency_active()) return;
+    std::cout << "\nWalker Concurrency: adaptive, " << describe_adaptive_concurrency(directory_walker.walk_concurrency_snapshot());
+}
+
+/**
+ * classified_entry_batch - Classification results travelling to the reporter stage
+ * Carries the discovery timestamp of its source batch so the consumer can
+ * measure discovery-to-report latency across the whole pipeline
+ */
+struct classified_entry_batch {
+    std::unique_ptr<discovered_directory_batch> source_batch_storage;  // Names the entries point into (address-stable)
+    std::vector<file_classification_entry> classified_entries;  // Entries classified from one input batch
+    std::chrono::steady_clock::time_point discovery_timestamp;  // When the source batch was discovered
+};
+
+/**
+ * publish_discovery_batch_in_chunks - Splits a directory batch into bounded work units
+ * Large directories are cut into CLASSIFICATION_BUFFER_SIZE filename chunks so a
+ * single queue slot never holds an unbounded amount of memory
+ */
+void publish_discovery_batch_in_chunks(discovered_directory_batch&& directory_batch,
+                                       bounded_lockfree_queue<discovered_directory_batch>& discovery_queue) {
+    if (directory_batch.filename_count <= static_cast<size_t>(CLASSIFICATION_BUFFER_SIZE)) {
+        discovery_queue.enqueue_blocking(std::move(directory_batch));
+        return;
+    }
+    
+    // Cut the packed buffer at every CLASSIFICATION_BUFFER_SIZE-th separator
+    const std::string& packed_filename_buffer = directory_batch.packed_filename_buffer;
+    size_t chunk_start = 0;
+    size_t chunk_first_name = 0;
+    while (chunk_start < packed_filename_buffer.size()) {
+        discovered_directory_batch chunk_batch;
+        chunk_batch.directory_path = directory_batch.directory_path;
+        chunk_batch.discovery_timestamp = directory_batch.discovery_timestamp;
+        size_t chunk_end = chunk_start;
+        while (chunk_end < packed_filename_buffer.size() &&
+               chunk_batch.filename_count < static_cast<size_t>(CLASSIFICATION_BUFFER_SIZE)) {
+            chunk_end = packed_filename_buffer.find(PACKED_FILENAME_SEPARATOR, chunk_end) + 1;
+            chunk_batch.filename_count++;
+        }
+        chunk_batch.packed_filename_buffer.assign(packed_filename_buffer, chunk_start, chunk_end - chunk_start);
+        if (!directory_batch.metadata_collection.empty()) {
+            auto chunk_metadata_begin = directory_batch.metadata_collection.begin() + chunk_first_name;
+            chunk_batch.metadata_collection.assign(chunk_metadata_begin, chunk_metadata_begin + chunk_batch.filename_count);
+        }
+        chunk_first_name += chunk_batch.filename_count;
+        discovery_queue.enqueue_blocking(std::move(chunk_batch));
+        chunk_start = chunk_end;
+    }
+}
+
+/**
+ * append_classified_directory_batch - Classifies a packed buffer into result entries
+ * This function runs the bulk kernel over the buffer and appends one
+ * file_classification_entry per name; entry names are views into
+ * packed_filenames and source_directory_path, which must outlive the entries.
+ * metadata_collection is either empty or holds one record per packed name
+ */
+void append_classified_directory_batch(std::string_view packed_filenames, std::string_view source_directory_path,
+                                       const std::vector<file_metadata_record>& metadata_collection,
+                                       const extension_classification_table& mapping_registry,
+                                       std::vector<file_classification_entry>& classified_entries) {
+    thread_local std::vector<packed_filename_classification> kernel_output;
+    kernel_output.clear();
+    classify_packed_filename_batch(packed_filenames, mapping_registry, kernel_output);
+    
+    for (size_t name_index = 0; name_index < kernel_output.size(); ++name_index) {
+        const packed_filename_classification& kernel_result = kernel_output[name_index];
+        file_classification_entry current_entry;
+        current_entry.filename_identifier = packed_filenames.substr(kernel_result.filename_offset, kernel_result.filename_length);
+        current_entry.source_directory_path = source_directory_path;
+        current_entry.file_size_bytes = metadata_collection.empty() ? 0 : metadata_collection[name_index].file_size_bytes;
+        current_entry.category_identifier = kernel_result.category_identifier;
+        current_entry.processing_priority = calculate_processing_priority(kernel_result.category_identifier);
+        classified_entries.push_back(current_entry);
+    }
+}
+
+/**
+ * content_signature_rule - Magic number identifying a file format
+ * A rule matches when the primary bytes appear at primary_offset and, for
+ * container formats such as RIFF, the optional secondary bytes appear too
+ */
+struct content_signature_rule {
+    uint8_t primary_offset;                   // Position of the primary magic bytes
+    const char* primary_bytes;                // Primary magic bytes
+    uint8_t primary_length;                   // Primary magic length
+    uint8_t secondary_offset;                 // Position of the subtype bytes (unused when length is 0)
+    const char* secondary_bytes;              // Subtype bytes
+    uint8_t secondary_length;                 // Subtype length (0 when absent)
+    classification_category_identifier category_identifier;  // Category of matching files
+};
+
+// Signatures ordered so container subtypes are tested before generic prefixes
+constexpr content_signature_rule CONTENT_SIGNATURE_RULES[] = {
+    {0, "RIFF", 4, 8, "WEBP", 4, CATEGORY_MULTIMEDIA_ASSETS},
+    {0, "RIFF", 4, 8, "WAVE", 4, CATEGORY_AUDIO_LIBRARY},
+    {0, "RIFF", 4, 8, "AVI ", 4, CATEGORY_VIDEO_CONTENT},
+    {0, "%PDF-", 5, 0, "", 0, CATEGORY_DOCUMENTS_REPOSITORY},
+    {0, "{\\rtf", 5, 0, "", 0, CATEGORY_DOCUMENTS_REPOSITORY},
+    {0, "\xD0\xCF\x11\xE0\xA1\xB1\x1A\xE1", 8, 0, "", 0, CATEGORY_DOCUMENTS_REPOSITORY},
+    {0, "\x89PNG\r\n\x1A\n", 8, 0, "", 0, CATEGORY_MULTIMEDIA_ASSETS},
+    {0, "\xFF\xD8\xFF", 3, 0, "", 0, CATEGORY_MULTIMEDIA_ASSETS},
+    {0, "GIF8", 4, 0, "", 0, CATEGORY_MULTIMEDIA_ASSETS},
+    {0, "ID3", 3, 0, "", 0, CATEGORY_AUDIO_LIBRARY},
+    {0, "fLaC", 4, 0, "", 0, CATEGORY_AUDIO_LIBRARY},
+    {0, "OggS", 4, 0, "", 0, CATEGORY_AUDIO_LIBRARY},
+    {4, "ftyp", 4, 0, "", 0, CATEGORY_VIDEO_CONTENT},
+    {0, "\x1A\x45\xDF\xA3", 4, 0, "", 0, CATEGORY_VIDEO_CONTENT},
+    {0, "PK\x03\x04", 4, 0, "", 0, CATEGORY_ARCHIVE_STORAGE},
+    {0, "\x1F\x8B", 2, 0, "", 0, CATEGORY_ARCHIVE_STORAGE},
+    {0, "7z\xBC\xAF\x27\x1C", 6, 0, "", 0, CATEGORY_ARCHIVE_STORAGE},
+    {0, "Rar!\x1A\x07", 6, 0, "", 0, CATEGORY_ARCHIVE_STORAGE},
+    {0, "\xFD" "7zXZ", 5, 0, "", 0, CATEGORY_ARCHIVE_STORAGE},
+    {0, "BZh", 3, 0, "", 0, CATEGORY_ARCHIVE_STORAGE},
+    {0, "\x28\xB5\x2F\xFD", 4, 0, "", 0, CATEGORY_ARCHIVE_STORAGE},
+    {0, "#!", 2, 0, "", 0, CATEGORY_SOURCE_CODE},
+};
+
+/**
+ * identify_content_signature - Matches leading file bytes against known formats
+ * Returns false when no signature matches the available bytes
+ */
+bool identify_content_signature(const unsigned char* leading_bytes, size_t available_length,
+                                classification_category_identifier& category_identifier) {
+    auto bytes_match = [&](uint8_t match_offset, const char* match_bytes, uint8_t match_length) {
+        return match_offset + match_length <= available_length &&
+               std::memcmp(leading_bytes + match_offset, match_bytes, match_length) == 0;
+    };
+    for (const content_signature_rule& signature_rule : CONTENT_SIGNATURE_RULES) {
+        if (!bytes_match(signature_rule.primary_offset, signature_rule.primary_bytes, signature_rule.primary_length)) continue;
+        if (signature_rule.secondary_length > 0 &&
+            !bytes_match(signature_rule.secondary_offset, signature_rule.secondary_bytes, signature_rule.secondary_length)) continue;
+        category_identifier = signature_rule.category_identifier;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * sniff_unclassified_directory_entries - Reclassifies extension misses by content
+ * Only MISCELLANEOUS_FILES entries that no user rule matched are examined.
+ * The source directory is opened once per batch and each candidate costs one
+ * openat plus a single CONTENT_SNIFF_LENGTH-byte pread, so trees dominated by
+ * known extensions pay almost nothing. Entry names and the directory path must be NUL-terminated
+ */
+void sniff_unclassified_directory_entries(std::string_view source_directory_path, file_classification_entry* entry_collection,
+                                          size_t entry_count, classification_statistics_accumulator& worker_statistics) {
+    auto is_candidate = [](const file_classification_entry& current_entry) {
+        return current_entry.category_identifier == CATEGORY_MISCELLANEOUS_FILES && !current_entry.rule_classified;
+    };
+    if (std::none_of(entry_collection, entry_collection + entry_count, is_candidate)) return;
+    
+#if defined(ARTLEST_POSIX_FILE_OPERATIONS)
+    int directory_descriptor = open(source_directory_path.data(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (directory_descriptor < 0) return;
+#endif
+    for (size_t entry_index = 0; entry_index < entry_count; ++entry_index) {
+        file_classification_entry& current_entry = entry_collection[entry_index];
+        if (!is_candidate(current_entry)) continue;
+        
+        unsigned char leading_bytes[CONTENT_SNIFF_LENGTH];
+        long long bytes_read = -1;
+#if defined(ARTLEST_POSIX_FILE_OPERATIONS)
+        // O_NONBLOCK keeps a FIFO swapped in after the walk from stalling the classifier
+        int file_descriptor = openat(directory_descriptor, current_entry.filename_identifier.data(),
+                                     O_RDONLY | O_NOFOLLOW | O_NONBLOCK | O_CLOEXEC);
+        if (file_descriptor >= 0) {
+            bytes_read = pread(file_descriptor, leading_bytes, CONTENT_SNIFF_LENGTH, 0);
+            close(file_descriptor);
+        }
+#else
+        std::ifstream file_stream(std::filesystem::path(source_directory_path) / std::filesystem::path(current_entry.filename_identifier),
+                                  std::ios::binary);
+        if (file_stream) {
+            file_stream.read(reinterpret_cast<char*>(leading_bytes), CONTENT_SNIFF_LENGTH);
+            bytes_read = file_stream.gcount();
+        }
+#endif
+        if (bytes_read <= 0) continue;
+        
+        worker_statistics.content_sniffed_files++;
+        classification_category_identifier sniffed_category;
+        if (identify_content_signature(leading_bytes, static_cast<size_t>(bytes_read), sniffed_category)) {
+            current_entry.category_identifier = sniffed_category;
+            current_entry.processing_priority = calculate_processing_priority(sniffed_category);
+            worker_statistics.content_reclassified_files++;
+        }
+    }
+#if defined(ARTLEST_POSIX_FILE_OPERATIONS)
+    close(directory_descriptor);
+#endif
+}
+
+/**
+ * traverse_configured_source - Walks --source, or only the subtrees of a loaded shard
+ */
+void traverse_configured_source(parallel_directory_walker& directory_walker,
+                                const execution_configuration_parameters& runtime_configuration,
+                                const parallel_directory_walker::directory_batch_callback& batch_callback) {
+    if (runtime_configuration.adaptive_concurrency_enabled) {
+        directory_walker.enable_adaptive_concurrency(runtime_configuration.walker_thread_count);
+    }
+    if (runtime_configuration.shard_manifest_path.empty()) {
+        directory_walker.traverse_directory_tree(runtime_configuration.source_directory_path, batch_callback);
+        return;
+    }
+    for (const std::string& excluded_path : runtime_configuration.shard_excluded_paths) directory_walker.exclude_directory_subtree(excluded_path);
+    directory_walker.traverse_directory_forest(runtime_configuration.shard_seed_paths, batch_callback);
+}
+
+/**
+ * external_entry_sorter - Orders an unbounded entry stream within a fixed memory budget
+ * Entries are encoded compactly (priority, category, size, then the NUL-
+ * terminated directory and name) into one run buffer. When the buffer and its
+ * sort index reach the budget, the run is sorted and spilled to a temporary
+ * file. finish() merges the runs k at a time, with k small enough that every
+ * input's read buffer fits the budget (extra passes when there are more runs),
+ * and hands the ordered entries to the sink in batches. Order is priority,
+ * then optionally size (largest first), then directory and name, so entries
+ * of one directory stay contiguous for the move executor
+ */
+class external_entry_sorter {
+public:
+    using entry_batch_sink = std::function<void(const file_classification_entry*, size_t)>;
+
+    external_entry_sorter(size_t memory_budget_bytes, const std::string& temporary_directory_path, bool size_ordering_enabled)
+        : run_budget_bytes(std::max(memory_budget_bytes / 2, memory_budget_bytes - std::min(memory_budget_bytes, EXTERNAL_SORT_RESERVED_BYTES))),
+          merge_fan_in(std::clamp<size_t>(run_budget_bytes / EXTERNAL_SORT_READ_BUFFER_SIZE, 2, EXTERNAL_SORT_MAXIMUM_FAN_IN)),
+          run_directory_path(temporary_directory_path),
+          order_by_size(size_ordering_enabled) {}
+
+    ~external_entry_sorter() {
+        for (const std::string& run_file_path : run_file_paths) std::remove(run_file_path.c_str());
+    }
+
+    external_entry_sorter(const external_entry_sorter&) = delete;
+    external_entry_sorter& operator=(const external_entry_sorter&) = delete;
+
+    // Encode entries into the current run, spilling it first whenever the budget would be exceeded
+    bool append_entries(const file_classification_entry* entry_collection, size_t entry_count, std::string& error_message) {
+        if (run_buffer.capacity() < run_budget_bytes) run_buffer.reserve(run_budget_bytes);  // Pages are touched only as records arrive
+        for (size_t entry_index = 0; entry_index < entry_count; ++entry_index) {
+            const file_classification_entry& current_entry = entry_collection[entry_index];
+            size_t record_size = RECORD_HEADER_SIZE + current_entry.source_directory_path.size() + current_entry.filename_identifier.size() + 2;
+            if (run_buffer.size() + record_size + (buffered_record_count + 1) * sizeof(uint64_t) > run_budget_bytes &&
+                buffered_record_count > 0 && !spill_run_buffer(error_message)) {
+                return false;
+            }
+            append_record(run_buffer, current_entry);
+            buffered_record_count++;
+            total_entry_count++;
+        }
+        return true;
+    }
+
+    /**
+     * finish - Emits every appended entry in order
+     * Entries handed to the sink, and their strings, are valid only during the call
+     */
+    bool finish(const entry_batch_sink& batch_sink, std::string& error_message) {
+        entry_batch_emitter batch_emitter(batch_sink);
+        if (run_file_paths.empty()) {
+            std::vector<uint64_t> record_offsets = sort_run_buffer();
+            for (uint64_t record_offset : record_offsets) batch_emitter.append_record(record_at(run_buffer.data() + record_offset));
+            batch_emitter.flush_batch();
+            release_run_buffer();
+            return true;
+        }
+        if (buffered_record_count > 0 && !spill_run_buffer(error_message)) return false;
+        release_run_buffer();
+        
+        // Merge groups of runs into longer runs until one final pass can take them all
+        while (run_file_paths.size() > merge_fan_in) {
+            std::vector<std::string> next_run_paths;
+            // On failure the destructor still owns every run file left on disk, merged or not
+            auto abandon_merge_pass = [&](size_t first_unmerged_run) {
+                if (first_unmerged_run < run_file_paths.size()) {
+                    next_run_paths.insert(next_run_paths.end(), run_file_paths.begin() + first_unmerged_run, run_file_paths.end());
+                }
+                run_file_paths = std::move(next_run_paths);
+                return false;
+            };
+            for (size_t group_start = 0; group_start < run_file_paths.size(); group_start += merge_fan_in) {
+                std::vector<std::string> group_paths(run_file_paths.begin() + group_start,
+                                                     run_file_paths.begin() + std::min(run_file_paths.size(), group_start + merge_fan_in));
+                std::string merged_run_path = next_run_file_path();
+                std::FILE* merged_run_file = std::fopen(merged_run_path.c_str(), "wb");
+                if (merged_run_file == nullptr) {
+                    error_message = merged_run_path + ": " + std::strerror(errno);
+                    return abandon_merge_pass(group_start);
+                }
+                next_run_paths.push_back(merged_run_path);
+                bool write_failed = false;
+                bool merged = merge_run_files(group_paths, [&](std::string_view encoded_record) {
+                    write_failed |= std::fwrite(encoded_record.data(), 1, encoded_record.size(), merged_run_file) != encoded_record.size();
+                }, error_message);
+                if (std::fclose(merged_run_file) != 0) write_failed = true;
+                for (const std::string& group_path : group_paths) std::remove(group_path.c_str());
+                if (!merged || write_failed) {
+                    if (error_message.empty()) error_message = merged_run_path + ": write failed";
+                    return abandon_merge_pass(group_start + merge_fan_in);
+                }
+                spilled_byte_count += static_cast<uint64_t>(std::filesystem::file_size(merged_run_path));
+            }
+            run_file_paths = std::move(next_run_paths);
+            merge_pass_count++;
+        }
+        
+        bool merged = merge_run_files(run_file_paths, [&](std::string_view encoded_record) {
+            batch_emitter.append_record(encoded_record);
+        }, error_message);
+        batch_emitter.flush_batch();
+        merge_pass_count++;
+        for (const std::string& run_file_path : run_file_paths) std::remove(run_file_path.c_str());
+        run_file_paths.clear();
+        return merged;
+    }
+
+    size_t sorted_entry_count() const { return total_entry_count; }
+    size_t spilled_run_count() const { return spilled_runs; }
+    size_t merge_pass_total() const { return merge_pass_count; }
+    uint64_t spilled_bytes() const { return spilled_byte_count; }
+    size_t run_budget() const { return run_budget_bytes; }
+    size_t fan_in() const { return merge_fan_in; }
+
+private:
+    // priority u8, category u8, size u64, directory length u32, name length u32
+    static constexpr size_t RECORD_HEADER_SIZE = 18;
+
+    static void append_record(std::string& record_buffer, const file_classification_entry& current_entry) {
+        char record_header[RECORD_HEADER_SIZE];
+        uint32_t directory_length = static_cast<uint32_t>(current_entry.source_directory_path.size());
+        uint32_t filename_length = static_cast<uint32_t>(current_entry.filename_identifier.size());
+        record_header[0] = static_cast<char>(current_entry.processing_priority);
+        record_header[1] = static_cast<char>(current_entry.category_identifier);
+        std::memcpy(record_header + 2, &current_entry.file_size_bytes, sizeof(uint64_t));
+        std::memcpy(record_header + 10, &directory_length, sizeof(uint32_t));
+        std::memcpy(record_header + 14, &filename_length, sizeof(uint32_t));
+        record_buffer.append(record_header, RECORD_HEADER_SIZE);
+        record_buffer.append(current_entry.source_directory_path);
+        record_buffer.push_back('\0');
+        record_buffer.append(current_entry.filename_identifier);
+        record_buffer.push_back('\0');
+    }
+
+    static size_t encoded_record_size(const char* record_data) {
+        uint32_t directory_length, filename_length;
+        std::memcpy(&directory_length, record_data + 10, sizeof(uint32_t));
+        std::memcpy(&filename_length, record_data + 14, sizeof(uint32_t));
+        return RECORD_HEADER_SIZE + directory_length + filename_length + 2;
+    }
+
+    static std::string_view record_at(const char* record_data) {
+        return std::string_view(record_data, encoded_record_size(record_data));
+    }
+
+    // Entry whose strings point into the encoded record
+    static file_classification_entry decode_record(std::string_view encoded_record) {
+        file_classification_entry decoded_entry;
+        uint32_t directory_length, filename_length;
+        decoded_entry.processing_priority = static_cast<uint8_t>(encoded_record[0]);
+        decoded_entry.category_identifier = static_cast<classification_category_identifier>(static_cast<uint8_t>(encoded_record[1]));
+        std::memcpy(&decoded_entry.file_size_bytes, encoded_record.data() + 2, sizeof(uint64_t));
+        std::memcpy(&directory_length, encoded_record.data() + 10, sizeof(uint32_t));
+        std::memcpy(&filename_length, encoded_record.data() + 14, sizeof(uint32_t));
+        decoded_entry.source_directory_path = encoded_record.substr(RECORD_HEADER_SIZE, directory_length);
+        decoded_entry.filename_identifier = encoded_record.substr(RECORD_HEADER_SIZE + directory_length + 1, filename_length);
+        return decoded_entry;
+    }
+
+    bool record_precedes(std::string_view left_record, std::string_view right_record) const {
+        if (left_record[0] != right_record[0]) return static_cast<uint8_t>(left_record[0]) < static_cast<uint8_t>(right_record[0]);
+        file_classification_entry left_entry = decode_record(left_record);
+        file_classification_entry right_entry = decode_record(right_record);
+        if (order_by_size && left_entry.file_size_bytes != right_entry.file_size_bytes) {
+            return left_entry.file_size_bytes > right_entry.file_size_bytes;
+        }
+        if (left_entry.source_directory_path != right_entry.source_directory_path) {
+            return left_entry.source_directory_path < right_entry.source_directory_path;
+        }
+        return left_entry.filename_identifier < right_entry.filename_identifier;
+    }
+
+    std::vector<uint64_t> sort_run_buffer() const {
+        std::vector<uint64_t> record_offsets;
+        record_offsets.reserve(buffered_record_count);
+        for (size_t record_offset = 0; record_offset < run_buffer.size();
+             record_offset += encoded_record_size(run_buffer.data() + record_offset)) {
+            record_offsets.push_back(record_offset);
+        }
+        std::sort(record_offsets.begin(), record_offsets.end(), [this](uint64_t left_offset, uint64_t right_offset) {
+            return record_precedes(record_at(run_buffer.data() + left_offset), record_at(run_buffer.data() + right_offset));
+        });
+        return record_offsets;
+    }
+
+    void release_run_buffer() {
+        std::string().swap(run_buffer);
+        buffered_record_count = 0;
+    }
+
+    std::string next_run_file_path() {
+        return (std::filesystem::path(run_directory_path) /
+                ("artlest-sort-" + std::to_string(reinterpret_cast<uintptr_t>(this)) + "-" + std::to_string(run_file_sequence++) + ".run")).string();
+    }
+
+    // Sort the buffered records and write them as one run file, keeping the buffer's capacity
+    bool spill_run_buffer(std::string& error_message) {
+        std::vector<uint64_t> record_offsets = sort_run_buffer();
+        std::string run_file_path = next_run_file_path();
+        std::FILE* run_file = std::fopen(run_file_path.c_str(), "wb");
+        if (run_file == nullptr) {
+            error_message = run_file_path + ": " + std::strerror(errno);
+            return false;
+        }
+        run_file_paths.push_back(run_file_path);
+        bool write_failed = false;
+        for (uint64_t record_offset : record_offsets) {
+            std::string_view encoded_record = record_at(run_buffer.data() + record_offset);
+            write_failed |= std::fwrite(encoded_record.data(), 1, encoded_record.size(), run_file) != encoded_record.size();
+        }
+        if (std::fclose(run_file) != 0 || write_failed) {
+            error_message = run_file_path + ": " + std::strerror(errno);
+            return false;
+        }
+        spilled_byte_count += run_buffer.size();
+        spilled_runs++;
+        run_buffer.clear();
+        buffered_record_count = 0;
+        return true;
+    }
+
+    // Sequential reader over one run file with a fixed-size buffer
+    struct run_file_reader {
+        std::FILE* run_file = nullptr;
+        std::vector<char> read_buffer;
+        size_t buffer_position = 0;           // Start of the current record
+        size_t buffer_length = 0;             // Valid bytes in read_buffer
+        size_t current_record_size = 0;       // Bytes of the current record (0 before the first read)
+        bool read_failed = false;
+
+        bool ensure_available(size_t byte_count) {
+            if (buffer_length - buffer_position >= byte_count) return true;
+            std::memmove(read_buffer.data(), read_buffer.data() + buffer_position, buffer_length - buffer_position);
+            buffer_length -= buffer_position;
+            buffer_position = 0;
+            if (read_buffer.size() < byte_count) read_buffer.resize(byte_count);  // Record longer than the buffer
+            buffer_length += std::fread(read_buffer.data() + buffer_length, 1, read_buffer.size() - buffer_length, run_file);
+            if (std::ferror(run_file)) read_failed = true;
+            return buffer_length >= byte_count;
+        }
+
+        // Step to the next record; false at the end of the run
+        bool advance_record() {
+            buffer_position += current_record_size;
+            current_record_size = 0;
+            if (!ensure_available(RECORD_HEADER_SIZE)) return false;
+            size_t record_size = encoded_record_size(read_buffer.data() + buffer_position);
+            if (!ensure_available(record_size)) {
+                read_failed = true;  // Truncated run
+                return false;
+            }
+            current_record_size = record_size;
+            return true;
+        }
+
+        std::string_view current_record() const { return std::string_view(read_buffer.data() + buffer_position, current_record_size); }
+    };
+
+    bool merge_run_files(const std::vector<std::string>& input_paths, const std::function<void(std::string_view)>& record_sink,
+                         std::string& error_message) const {
+        std::vector<run_file_reader> run_readers(input_paths.size());
+        bool merge_succeeded = true;
+        for (size_t reader_index = 0; reader_index < input_paths.size() && merge_succeeded; ++reader_index) {
+            run_readers[reader_index].run_file = std::fopen(input_paths[reader_index].c_str(), "rb");
+            if (run_readers[reader_index].run_file == nullptr) {
+                error_message = input_paths[reader_index] + ": " + std::strerror(errno);
+                merge_succeeded = false;
+                break;
+            }
+            run_readers[reader_index].read_buffer.resize(EXTERNAL_SORT_READ_BUFFER_SIZE);
+        }
+        
+        // Min-heap of readers keyed by their current record
+        auto reader_follows = [&](size_t left_reader, size_t right_reader) {
+            return record_precedes(run_readers[right_reader].current_record(), run_readers[left_reader].current_record());
+        };
+        std::vector<size_t> reader_heap;
+        for (size_t reader_index = 0; reader_index < run_readers.size() && merge_succeeded; ++reader_index) {
+            if (run_readers[reader_index].advance_record()) reader_heap.push_back(reader_index);
+        }
+        std::make_heap(reader_heap.begin(), reader_heap.end(), reader_follows);
+        while (merge_succeeded && !reader_heap.empty()) {
+            std::pop_heap(reader_heap.begin(), reader_heap.end(), reader_follows);
+            size_t reader_index = reader_heap.back();
+            record_sink(run_readers[reader_index].current_record());
+            if (run_readers[reader_index].advance_record()) {
+                std::push_heap(reader_heap.begin(), reader_heap.end(), reader_follows);
+            } else {
+                reader_heap.pop_back();
+            }
+        }
+        for (size_t reader_index = 0; reader_index < run_readers.size(); ++reader_index) {
+            if (run_readers[reader_index].read_failed && merge_succeeded) {
+                error_message = input_paths[reader_index] + ": unreadable or truncated run";
+                merge_succeeded = false;
+            }
+            if (run_readers[reader_index].run_file != nullptr) std::fclose(run_readers[reader_index].run_file);
+        }
+        return merge_succeeded;
+    }
+
+    // Copies ordered records into batch-local storage and hands them to the sink as entries
+    class entry_batch_emitter {
+    public:
+        explicit entry_batch_emitter(const entry_batch_sink& batch_sink) : emission_sink(batch_sink) {}
+
+        void append_record(std::string_view encoded_record) {
+            record_offsets.push_back(batch_storage.size());
+            batch_storage.append(encoded_record);
+            if (record_offsets.size() >= EXTERNAL_SORT_EMIT_BATCH_SIZE) flush_batch();
+        }
+
+        void flush_batch() {
+            if (record_offsets.empty()) return;
+            decoded_entries.clear();
+            for (size_t record_offset : record_offsets) decoded_entries.push_back(decode_record(record_at(batch_storage.data() + record_offset)));
+            emission_sink(decoded_entries.data(), decoded_entries.size());
+            record_offsets.clear();
+            batch_storage.clear();
+        }
+
+    private:
+        const entry_batch_sink& emission_sink;
+        std::string batch_storage;                            // Encoded records of the pending batch
+        std::vector<size_t> record_offsets;                   // Record starts within batch_storage
+        std::vector<file_classification_entry> decoded_entries;  // Entries viewing batch_storage
+    };
+
+    size_t run_budget_bytes;                  // Run buffer plus sort index limit
+    size_t merge_fan_in;                      // Runs merged per pass (one read buffer each)
+    std::string run_directory_path;           // Directory receiving temporary run files
+    bool order_by_size;                       // Larger files first within a priority level
+    std::string run_buffer;                   // Encoded records of the current run
+    size_t buffered_record_count = 0;         // Records in run_buffer
+    size_t total_entry_count = 0;             // Records appended overall
+    std::vector<std::string> run_file_paths;  // Spilled runs not yet merged away
+    size_t run_file_sequence = 0;             // Suffix of the next run file
+    size_t spilled_runs = 0;                  // Runs written from the run buffer
+    size_t merge_pass_count = 0;              // Merge passes, including the final one
+    uint64_t spilled_byte_count = 0;          // Bytes written to run files over all passes
+};
+
+/**
+ * live_statistics_exporter - Rewrites a Prometheus text-format statistics file during a run
+ * Every interval, and once more when stopped, the exporter thread sums the
+ * published worker counters, the move executor's published totals and the
+ * attached walker's and queues' atomics, writes "<path>.tmp" and renames it
+ * over the path, so a scraper (e.g. the node_exporter textfile collector)
+ * never reads a partial file. Workers never take the exporter lock; it only
+ * orders the coordinating thread's attach and detach calls against sampling
+ */
+class live_statistics_exporter {
+public:
+    live_statistics_exporter(const std::string& statistics_path, double interval_seconds)
+        : statistics_file_path(statistics_path),
+          export_interval(std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+              std::chrono::duration<double>(interval_seconds))),
+          export_start(std::chrono::steady_clock::now()),
+          last_sample_time(export_start) {}
+
+    ~live_statistics_exporter() { stop_exporting(); }
+
+    live_statistics_exporter(const live_statistics_exporter&) = delete;
+    live_statistics_exporter& operator=(const live_statistics_exporter&) = delete;
+
+    void attach_classification_counters(const published_classification_counters& worker_counters) {
+        std::lock_guard<std::mutex> exporter_guard(exporter_lock);
+        counter_sources.push_back(&worker_counters);
+    }
+
+    void attach_move_executor(const file_move_executor& move_executor) {
+        std::lock_guard<std::mutex> exporter_guard(exporter_lock);
+        move_source = &move_executor;
+    }
+
+    void attach_walker(const parallel_directory_walker& directory_walker) {
+        std::lock_guard<std::mutex> exporter_guard(exporter_lock);
+        walker_source = &directory_walker;
+    }
+
+    void attach_queue_depth(std::string queue_name, std::function<size_t()> depth_sampler) {
+        std::lock_guard<std::mutex> exporter_guard(exporter_lock);
+        queue_depth_sources.emplace_back(std::move(queue_name), std::move(depth_sampler));
+    }
+
+    // Keep the walker's final counts and forget walker and queues before they are destroyed
+    void detach_pipeline() {
+        std::lock_guard<std::mutex> exporter_guard(exporter_lock);
+        if (walker_source != nullptr) {
+            retained_directories_visited += walker_source->visited_directory_count();
+            retained_traversal_errors += walker_source->traversal_error_count();
+            walker_source = nullptr;
+        }
+        queue_depth_sources.clear();
+    }
+
+    void start_exporting() {
+        exporter_thread = std::thread([this] {
+            std::unique_lock<std::mutex> exporter_guard(exporter_lock);
+            while (!stop_signal.wait_for(exporter_guard, export_interval, [this] { return stop_requested; })) {
+                write_statistics_file();
+            }
+        });
+    }
+
+    // Stop the thread and write the final totals
+    void stop_exporting() {
+        if (!exporter_thread.joinable()) return;
+        {
+            std::lock_guard<std::mutex> exporter_guard(exporter_lock);
+            stop_requested = true;
+        }
+        stop_signal.notify_one();
+        exporter_thread.join();
+        std::lock_guard<std::mutex> exporter_guard(exporter_lock);
+        write_statistics_file();
+    }
+
+private:
+    static void write_metric_header(std::ostream& metrics_output, const char* metric_name, const char* metric_type,
+                                    const char* metric_help) {
+        metrics_output << "# HELP " << metric_name << " " << metric_help << "\n"
+                       << "# TYPE " << metric_name << " " << metric_type << "\n";
+    }
+
+    // Sample every source and replace the statistics file; exporter_lock is held
+    void write_statistics_file() {
+        classification_statistics_accumulator sampled_totals;
+        for (const published_classification_counters* counter_source : counter_sources) {
+            counter_source->accumulate_into(sampled_totals);
+        }
+        auto sample_time = std::chrono::steady_clock::now();
+        double sample_interval_seconds = std::chrono::duration<double>(sample_time - last_sample_time).count();
+        double classification_rate = sample_interval_seconds > 0.0
+                                         ? (sampled_totals.total_files_processed - last_classified_file_count) / sample_interval_seconds
+                                         : 0.0;
+        last_sample_time = sample_time;
+        last_classified_file_count = sampled_totals.total_files_processed;
+        
+        std::ostringstream metrics_output;
+        write_metric_header(metrics_output, "artlest_files_classified_total", "counter", "Files classified since the run started");
+        metrics_output << "artlest_files_classified_total " << sampled_totals.total_files_processed << "\n";
+        write_metric_header(metrics_output, "artlest_category_files_total", "counter", "Files classified per destination category");
+        for (int category_index = 0; category_index < CLASSIFICATION_CATEGORY_COUNT; ++category_index) {
+            metrics_output << "artlest_category_files_total{category=\"" << CLASSIFICATION_CATEGORY_TABLE[category_index].directory_name
+                           << "\"} " << sampled_totals.category_distribution_metrics[category_index] << "\n";
+        }
+        write_metric_header(metrics_output, "artlest_priority_files_total", "counter", "Files classified per processing priority");
+        for (int priority_level = 1; priority_level <= MAXIMUM_PRIORITY_LEVEL; ++priority_level) {
+            metrics_output << "artlest_priority_files_total{priority=\"" << priority_level << "\"} "
+                           << sampled_totals.priority_level_distribution[priority_level] << "\n";
+        }
+        write_metric_header(metrics_output, "artlest_bytes_observed_total", "counter", "Bytes of classified files with metadata");
+        metrics_output << "artlest_bytes_observed_total " << sampled_totals.total_bytes_observed << "\n";
+        write_metric_header(metrics_output, "artlest_classification_rate", "gauge", "Files classified per second over the last interval");
+        metrics_output << "artlest_classification_rate " << std::fixed << std::setprecision(1) << classification_rate << "\n";
+        write_metric_header(metrics_output, "artlest_uptime_seconds", "gauge", "Seconds since statistics export started");
+        metrics_output << "artlest_uptime_seconds " << std::setprecision(3)
+                       << std::chrono::duration<double>(sample_time - export_start).count() << "\n";
+        
+        size_t directories_visited = retained_directories_visited;
+        size_t traversal_errors = retained_traversal_errors;
+        if (walker_source != nullptr) {
+            directories_visited += walker_source->visited_directory_count();
+            traversal_errors += walker_source->traversal_error_count();
+        }
+        write_metric_header(metrics_output, "artlest_directories_visited_total", "counter", "Directories listed by the walker");
+        metrics_output << "artlest_directories_visited_total " << directories_visited << "\n";
+        write_metric_header(metrics_output, "artlest_traversal_errors_total", "counter", "Directory listing and status errors");
+        metrics_output << "artlest_traversal_errors_total " << traversal_errors << "\n";
+        if (!queue_depth_sources.empty()) {
+            write_metric_header(metrics_output, "artlest_queue_depth", "gauge", "Batches waiting between pipeline stages");
+            for (const auto& [queue_name, depth_sampler] : queue_depth_sources) {
+                metrics_output << "artlest_queue_depth{queue=\"" << queue_name << "\"} " << depth_sampler() << "\n";
+            }
+        }
+        
+        if (move_source != nullptr) {
+            file_move_statistics move_totals = move_source->published_move_statistics();
+            write_metric_header(metrics_output, "artlest_files_moved_total", "counter", "Files moved into the destination");
+            metrics_output << "artlest_files_moved_total{method=\"rename\"} " << move_totals.files_renamed << "\n"
+                           << "artlest_files_moved_total{method=\"copy\"} " << move_totals.files_copied << "\n";
+            write_metric_header(metrics_output, "artlest_move_failures_total", "counter", "Files left in place because a move failed");
+            metrics_output << "artlest_move_failures_total " << move_totals.failed_moves << "\n";
+            write_metric_header(metrics_output, "artlest_collision_renames_total", "counter", "Moves that needed a numbered name");
+            metrics_output << "artlest_collision_renames_total " << move_totals.collision_renames << "\n";
+            write_metric_header(metrics_output, "artlest_bytes_copied_total", "counter", "Bytes copied by cross-device moves");
+            metrics_output << "artlest_bytes_copied_total " << move_totals.bytes_copied << "\n";
+        }
+        
+        std::string temporary_path = statistics_file_path + ".tmp";
+        std::ofstream statistics_stream(temporary_path, std::ios::binary | std::ios::trunc);
+        statistics_stream << metrics_output.str();
+        statistics_stream.close();
+        std::error_code rename_error;
+        if (statistics_stream) std::filesystem::rename(temporary_path, statistics_file_path, rename_error);
+        if ((!statistics_stream || rename_error) && !write_failure_reported) {
+            std::cerr << "\nCannot write statistics file " << statistics_file_path << ": "
+                      << (rename_error ? rename_error.message() : std::string(std::strerror(errno))) << "\n";
+            write_failure_reported = true;
+        }
+    }
+
+    std::string statistics_file_path;         // Replaced atomically on every export
+    std::chrono::steady_clock::duration export_interval;  // Period between rewrites
+    std::chrono::steady_clock::time_point export_start;   // Origin of the uptime gauge
+    std::chrono::steady_clock::time_point last_sample_time;  // Previous sample, for the rate gauge
+    long long last_classified_file_count = 0;  // Previous sample's total, for the rate gauge
+    std::vector<const published_classification_counters*> counter_sources;  // One per worker
+    const file_move_executor* move_source = nullptr;       // Move totals (null without moves)
+    const parallel_directory_walker* walker_source = nullptr;  // Walker of the running pass
+    std::vector<std::pair<std::string, std::function<size_t()>>> queue_depth_sources;  // Named queue samplers
+    size_t retained_directories_visited = 0;  // Counts of detached walkers
+    size_t retained_traversal_errors = 0;
+    bool write_failure_reported = false;      // The first failed write is reported, later ones are not
+    bool stop_requested = false;              // Guarded by exporter_lock
+    std::mutex exporter_lock;
+    std::condition_variable stop_signal;      // Wakes the exporter early on shutdown
+    std::thread exporter_thread;
+};
+
+/**
+ * execute_streaming_classification_pipeline - Producer/classifier/reporter pipeline
+ * This function connects a producer (directory walker or demonstration dataset),
+ * N classifier workers and a single mover/reporter consumer through bounded
+ * lock-free queues, so entries are acted on as soon as they are classified and memory
+ * stays proportional to queue capacity instead of total file count; returns false
+ * when the external sort fails and its entries could not be reported or moved
+ */
+bool execute_streaming_classification_pipeline(const execution_configuration_parameters& runtime_configuration,
+                                               const extension_classification_table& mapping_registry,
+                                               std::vector<classification_worker_state>& worker_states,
+                                               file_move_executor* move_executor,
+                                               incremental_index_session* index_session,
+                                               tsv_result_writer* tsv_output,
+                                               const rule_configuration_matcher& rule_matcher,
+                                               live_statistics_exporter* statistics_exporter = nullptr) {
+    bounded_lockfree_queue<discovered_directory_batch> discovery_queue(STREAMING_QUEUE_CAPACITY);
+    bounded_lockfree_queue<classified_entry_batch> classified_queue(STREAMING_QUEUE_CAPACITY);
+    parallel_directory_walker directory_walker(runtime_configuration.walker_thread_count);
+    if (!runtime_configuration.destination_directory_path.empty()) {
+        directory_walker.exclude_directory_subtree(runtime_configuration.destination_directory_path);
+    }
+    if (runtime_configuration.metadata_collection_enabled) {
+        directory_walker.enable_metadata_collection(runtime_configuration.io_uring_backend_enabled);
+    }
+    if (index_session != nullptr) directory_walker.attach_incremental_index(index_session);
+    if (statistics_exporter != nullptr) {
+        statistics_exporter->attach_walker(directory_walker);
+        statistics_exporter->attach_queue_depth("discovery", [&discovery_queue] { return discovery_queue.approximate_size(); });
+        statistics_exporter->attach_queue_depth("classified", [&classified_queue] { return classified_queue.approximate_size(); });
+    }
+    
+    // Producer stage: publish discovered filenames in bounded chunks
+    std::thread producer_thread([&] {
+        if (runtime_configuration.source_directory_path.empty() && runtime_configuration.synthetic_name_count > 0) {
+            // Generate straight into packed chunks; the full name list is never materialized
+            synthetic_filename_generator name_generator(runtime_configuration.synthetic_zipf_exponent,
+                                                        runtime_configuration.synthetic_miss_rate, runtime_configuration.synthetic_seed);
+            for (size_t names_published = 0; names_published < runtime_configuration.synthetic_name_count;) {
+                discovered_directory_batch synthetic_batch;
+                synthetic_batch.filename_count = std::min(static_cast<size_t>(CLASSIFICATION_BUFFER_SIZE),
+                                                          runtime_configuration.synthetic_name_count - names_published);
+                name_generator.append_packed_names(synthetic_batch.packed_filename_buffer, synthetic_batch.filename_count);
+                synthetic_batch.discovery_timestamp = std::chrono::steady_clock::now();
+                names_published += synthetic_batch.filename_count;
+                discovery_queue.enqueue_blocking(std::move(synthetic_batch));
+            }
+        } else if (runtime_configuration.source_directory_path.empty()) {
+            std::vector<std::string> demonstration_filename_collection;
+            prepare_input_dataset(runtime_configuration, demonstration_filename_collection);
+            discovered_directory_batch demonstration_batch;
+            for (const std::string& current_filename : demonstration_filename_collection) {
+                append_packed_filename(demonstration_batch.packed_filename_buffer, current_filename);
+            }
+            demonstration_batch.filename_count = demonstration_filename_collection.size();
+            demonstration_batch.discovery_timestamp = std::chrono::steady_clock::now();
+            publish_discovery_batch_in_chunks(std::move(demonstration_batch), discovery_queue);
+        } else {
+            traverse_configured_source(directory_walker, runtime_configuration,
+                [&discovery_queue](discovered_directory_batch&& directory_batch) {
+                    publish_discovery_batch_in_chunks(std::move(directory_batch), discovery_queue);
+                });
+        }
+        discovery_queue.close_queue();
+    });
+    
+    // Classifier stage: the last worker to finish closes the reporter queue
+    int classifier_thread_count = static_cast<int>(worker_states.size());
+    std::atomic<int> active_classifier_count(classifier_thread_count);
+    std::vector<std::thread> classifier_thread_collection;
+    for (int classifier_index = 0; classifier_index < classifier_thread_count; ++classifier_index) {
+        classifier_thread_collection.emplace_back([&, classifier_index] {
+            classification_statistics_accumulator& worker_statistics = worker_states[classifier_index].statistics_accumulator;
+            discovered_directory_batch directory_batch;
+            while (discovery_queue.dequeue_blocking(directory_batch)) {
+                classified_entry_batch result_batch;
+                result_batch.discovery_timestamp = directory_batch.discovery_timestamp;
+                result_batch.classified_entries.reserve(directory_batch.filename_count);
+                result_batch.source_batch_storage.reset(new discovered_directory_batch(std::move(directory_batch)));
+                append_classified_directory_batch(result_batch.source_batch_storage->packed_filename_buffer,
+                                                  result_batch.source_batch_storage->directory_path,
+                                                  result_batch.source_batch_storage->metadata_collection, mapping_registry,
+                                                  result_batch.classified_entries);
+                if (rule_matcher.has_rules()) {
+                    apply_rule_configuration_to_entries(rule_matcher, result_batch.source_batch_storage->directory_path,
+                                                        result_batch.classified_entries.data(), result_batch.classified_entries.size());
+                }
+                if (runtime_configuration.content_sniffing_enabled) {
+                    sniff_unclassified_directory_entries(result_batch.source_batch_storage->directory_path,
+                                                         result_batch.classified_entries.data(),
+                                                         result_batch.classified_entries.size(), worker_statistics);
+                }
+                for (const file_classification_entry& classified_entry : result_batch.classified_entries) {
+                    worker_statistics.record_classified_entry(classified_entry);
+                }
+                if (statistics_exporter != nullptr) worker_states[classifier_index].published_statistics.publish_statistics(worker_statistics);
+                classified_queue.enqueue_blocking(std::move(result_batch));
+            }
+            if (active_classifier_count.fetch_sub(1) == 1) classified_queue.close_queue();
+        });
+    }
+    
+    // Mover/reporter stage: emit (and move) entries in arrival order while tracking latency,
+    // or feed the external sort and emit in sorted order once classification ends
+    std::unique_ptr<external_entry_sorter> entry_sorter;
+    if (runtime_configuration.sort_memory_limit_bytes > 0) {
+        std::error_code temporary_error;
+        std::string run_directory_path = runtime_configuration.sort_temporary_directory.empty()
+                                             ? std::filesystem::temp_directory_path(temporary_error).string()
+                                             : runtime_configuration.sort_temporary_directory;
+        entry_sorter = std::make_unique<external_entry_sorter>(runtime_configuration.sort_memory_limit_bytes, run_directory_path,
+                                                               runtime_configuration.sort_by_size_enabled);
+    }
+    bool report_output_enabled = !runtime_configuration.quiet_mode_enabled;
+    bool table_output_enabled = report_output_enabled && runtime_configuration.output_format == RESULT_OUTPUT_TABLE;
+    size_t reported_entry_count = 0;
+    auto report_entry_batch = [&](const file_classification_entry* entry_collection, size_t entry_count) {
+        if (table_output_enabled) {
+            display_processing_results_table(entry_collection, entry_count);
+        } else if (tsv_output != nullptr) {
+            tsv_output->append_entries(entry_collection, entry_count);
+        }
+        reported_entry_count += entry_count;
+        if (move_executor != nullptr) move_executor->execute_move_batch(entry_collection, entry_count);
+    };
+    if (table_output_enabled && !entry_sorter) {
+        std::cout << "╔══════════════════════════════════════════════════════════════╗\n";
+        std::cout << "║              PROCESSING RESULTS (STREAMING ORDER)            ║\n";
+        std::cout << "╠══════════════════════════════════════════════════════════════╣\n";
+    }
+    
+    classified_entry_batch result_batch;
+    std::chrono::steady_clock::duration maximum_report_latency{0};
+    std::string sort_error_message;
+    bool sort_succeeded = true;
+    while (classified_queue.dequeue_blocking(result_batch)) {
+        if (!entry_sorter) {
+            report_entry_batch(result_batch.classified_entries.data(), result_batch.classified_entries.size());
+        } else if (sort_succeeded) {
+            sort_succeeded = entry_sorter->append_entries(result_batch.classified_entries.data(),
+                                                          result_batch.classified_entries.size(), sort_error_message);
+        }
+        maximum_report_latency = std::max(maximum_report_latency,
+                                          std::chrono::steady_clock::now() - result_batch.discovery_timestamp);
+    }
+    
+    producer_thread.join();
+    for (auto& classifier_thread : classifier_thread_collection) classifier_thread.join();
+    
+    if (entry_sorter) {
+        if (table_output_enabled) {
+            std::cout << "╔══════════════════════════════════════════════════════════════╗\n";
+            std::cout << "║             PROCESSING RESULTS (EXTERNAL SORT ORDER)         ║\n";
+            std::cout << "╠══════════════════════════════════════════════════════════════╣\n";
+        }
+        if (sort_succeeded) sort_succeeded = entry_sorter->finish(report_entry_batch, sort_error_message);
+    }
+    
+    if (table_output_enabled) {
+        std::cout << "╚══════════════════════════════════════════════════════════════╝\n";
+    } else if (report_output_enabled && runtime_configuration.output_format != RESULT_OUTPUT_TABLE) {
+        display_result_file_summary(runtime_configuration, reported_entry_count);
+    }
+    if (report_output_enabled) {
+        std::cout << "\nClassifier Threads: " << classifier_thread_count
+                  << " | Maximum Discovery-to-Report Latency: "
+                  << std::chrono::duration_cast<std::chrono::microseconds>(maximum_report_latency).count() << " us";
+    }
+    if (entry_sorter && report_output_enabled) {
+        std::cout << "\nExternal Sort: " << entry_sorter->sorted_entry_count() << " entries, " << entry_sorter->spilled_run_count()
+                  << " runs spilled (" << entry_sorter->spilled_bytes() << " bytes written), " << entry_sorter->merge_pass_total()
+                  << " merge passes, run budget " << (entry_sorter->run_budget() >> 20) << " MB, fan-in " << entry_sorter->fan_in();
+    }
+    if (!sort_succeeded) std::cerr << "\nExternal sort failed: " << sort_error_message << "\n";
+    if (report_output_enabled && !runtime_configuration.source_directory_path.empty()) {
+        std::cout << "\nDirectories Visited: " << directory_walker.visited_directory_count()
+                  << " | Traversal Errors: " << directory_walker.traversal_error_count()
+                  << " | Walker Threads: " << directory_walker.resolved_thread_count();
+        display_metadata_backend(runtime_configuration, directory_walker);
+        display_walker_concurrency(directory_walker);
+    }
+    if (index_session != nullptr) {
+        index_session->skipped_directory_count = directory_walker.skipped_directory_count();
+        index_session->unchanged_file_count = directory_walker.unchanged_file_count();
+    }
+    if (statistics_exporter != nullptr) statistics_exporter->detach_pipeline();
+    return sort_succeeded;
+}
+
+/**
+ * collect_input_filename_collection - Gathers every input filename before timing
+ * This function materializes the demonstration dataset or the walked source tree
+ * so that traversal cost is excluded from classification measurements
+ */
+void collect_input_filename_collection(const execution_configuration_parameters& runtime_configuration,
+                                       std::vector<std::string>& filename_collection) {
+    if (runtime_configuration.source_directory_path.empty()) {
+        prepare_input_dataset(runtime_configuration, filename_collection);
+        return;
+    }
+    
+    filename_collection.clear();
+    std::mutex collection_lock;
+    parallel_directory_walker directory_walker(runtime_configuration.walker_thread_count);
+    traverse_configured_source(directory_walker, runtime_configuration,
+        [&](discovered_directory_batch&& directory_batch) {
+            std::lock_guard<std::mutex> collection_guard(collection_lock);
+            std::string_view packed_filenames = directory_batch.packed_filename_buffer;
+            while (!packed_filenames.empty()) {
+                size_t separator_position = packed_filenames.find(PACKED_FILENAME_SEPARATOR);
+                filename_collection.emplace_back(packed_filenames.substr(0, separator_position));
+                packed_filenames.remove_prefix(separator_position + 1);
+            }
+        });
+}
+
+/**
+ * execute_throughput_measurement - Measures classification cost without delays
+ * This function repeatedly classifies the collected input and reports sustained
+ * files per second and nanoseconds per file for the classify stage alone
+ */
+void execute_throughput_measurement(const execution_configuration_parameters& runtime_configuration,
+                                    const extension_classification_table& mapping_registry) {
+    std::vector<std::string> input_filename_collection;
+    collect_input_filename_collection(runtime_configuration, input_filename_collection);
+    if (input_filename_collection.empty()) {
+        std::cout << "No input files available for throughput measurement.\n";
+        return;
+    }
+    
+    // Repeat small inputs until the sample is large enough to time reliably
+    long long repeat_count = runtime_configuration.throughput_repeat_count;
+    if (repeat_count <= 0) {
+        repeat_count = (THROUGHPUT_MINIMUM_SAMPLE_SIZE + input_filename_collection.size() - 1) /
+                       static_cast<long long>(input_filename_collection.size());
+    }
+    
+    // Accumulate priorities so the optimizer cannot discard the classification work;
+    // the batch pass subtracts the same sum, so a non-zero residual flags a mismatch
+    long long priority_checksum = 0;
+    auto measurement_start = std::chrono::steady_clock::now();
+    for (long long repeat_index = 0; repeat_index < repeat_count; ++repeat_index) {
+        for (const std::string& current_filename : input_filename_collection) {
+            priority_checksum += classify_filename_entry(current_filename, mapping_registry).processing_priority;
+        }
+    }
+    auto measurement_end = std::chrono::steady_clock::now();
+    
+    // Time the bulk kernel over the same names packed into one buffer
+    std::string packed_filename_buffer;
+    for (const std::string& current_filename : input_filename_collection) {
+        append_packed_filename(packed_filename_buffer, current_filename);
+    }
+    std::vector<packed_filename_classification> kernel_output;
+    kernel_output.reserve(input_filename_collection.size());
+    auto batch_measurement_start = std::chrono::steady_clock::now();
+    for (long long repeat_index = 0; repeat_index < repeat_count; ++repeat_index) {
+        kernel_output.clear();
+        classify_packed_filename_batch(packed_filename_buffer, mapping_registry, kernel_output);
+        for (const packed_filename_classification& kernel_result : kernel_output) {
+            priority_checksum -= calculate_processing_priority(kernel_result.category_identifier);
+        }
+    }
+    auto batch_measurement_end = std::chrono::steady_clock::now();
+    
+    // Split the same passes across classifier threads, each with private histograms
+    int parallel_thread_count = resolve_worker_thread_count(runtime_configuration.classifier_thread_count);
+    std::vector<classification_worker_state> worker_states(parallel_thread_count);
+    std::vector<std::thread> parallel_thread_collection;
+    auto parallel_measurement_start = std::chrono::steady_clock::now();
+    for (int thread_index = 0; thread_index < parallel_thread_count; ++thread_index) {
+        parallel_thread_collection.emplace_back([&, thread_index] {
+            classification_statistics_accumulator& worker_statistics = worker_states[thread_index].statistics_accumulator;
+            std::vector<packed_filename_classification> worker_output;
+            worker_output.reserve(input_filename_collection.size());
+            for (long long repeat_index = thread_index; repeat_index < repeat_count; repeat_index += parallel_thread_count) {
+                worker_output.clear();
+                classify_packed_filename_batch(packed_filename_buffer, mapping_registry, worker_output);
+                for (const packed_filename_classification& kernel_result : worker_output) {
+                    worker_statistics.category_distribution_metrics[kernel_result.category_identifier]++;
+                    worker_statistics.priority_level_distribution[calculate_processing_priority(kernel_result.category_identifier)]++;
+                    worker_statistics.total_files_processed++;
+                }
+            }
+        });
+    }
+    for (auto& parallel_thread : parallel_thread_collection) parallel_thread.join();
+    auto parallel_measurement_end = std::chrono::steady_clock::now();
+    classification_statistics_accumulator parallel_statistics;
+    for (const classification_worker_state& worker_state : worker_states) {
+        parallel_statistics.merge_statistics(worker_state.statistics_accumulator);
+    }
+    
+    long long classified_file_count = repeat_count * static_cast<long long>(input_filename_collection.size());
+    double elapsed_nanoseconds = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(measurement_end - measurement_start).count());
+    double nanoseconds_per_file = elapsed_nanoseconds / classified_file_count;
+    double files_per_second = elapsed_nanoseconds > 0 ? classified_file_count * 1e9 / elapsed_nanoseconds : 0.0;
+    double batch_nanoseconds_per_file = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(batch_measurement_end - batch_measurement_start).count()) /
+        classified_file_count;
+    double parallel_elapsed_nanoseconds = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(parallel_measurement_end - parallel_measurement_start).count());
+    double parallel_files_per_second = parallel_elapsed_nanoseconds > 0
+                                           ? parallel_statistics.total_files_processed * 1e9 / parallel_elapsed_nanoseconds : 0.0;
+    
+    std::cout << "╔══════════════════════════════════════════════════════════════╗\n";
+    std::cout << "║                  CLASSIFY STAGE THROUGHPUT                   ║\n";
+    std::cout << "╠══════════════════════════════════════════════════════════════╣\n";
+    std::cout << "║ Distinct Input Files:  " << std::setw(37) << input_filename_collection.size() << " ║\n";
+    std::cout << "║ Measurement Passes:    " << std::setw(37) << repeat_count << " ║\n";
+    std::cout << "║ Files Classified:      " << std::setw(37) << classified_file_count << " ║\n";
+    std::cout << "║ Elapsed Time (ms):     " << std::setw(37) << std::fixed << std::setprecision(3)
+              << elapsed_nanoseconds / 1e6 << " ║\n";
+    std::cout << "║ Throughput (files/s):  " << std::setw(37) << std::setprecision(0) << files_per_second << " ║\n";
+    std::cout << "║ Cost (ns/file):        " << std::setw(37) << std::setprecision(2) << nanoseconds_per_file << " ║\n";
+    std::cout << "║ Batch Kernel:          " << std::setw(37) << select_packed_classification_kernel().kernel_name << " ║\n";
+    std::cout << "║ Batch Cost (ns/file):  " << std::setw(37) << batch_nanoseconds_per_file << " ║\n";
+    std::cout << "║ Parallel Threads:      " << std::setw(37) << parallel_thread_count << " ║\n";
+    std::cout << "║ Parallel (files/s):    " << std::setw(37) << std::setprecision(0) << parallel_files_per_second << " ║\n";
+    std::cout << "║ Checksum Residual:     " << std::setw(37) << priority_checksum << " ║\n";
+    std::cout << "╚══════════════════════════════════════════════════════════════╝\n";
+}
+
+/**
+ * execute_parallel_collection_pass - Walks and classifies the source tree on a thread pool
+ * Walker threads feed a bounded queue drained by one classifier per worker
+ * state; every worker appends to its own result columns and histograms, so
+ * the hot loop touches no shared cache lines besides the queue itself
+ */
+void execute_parallel_collection_pass(const execution_configuration_parameters& runtime_configuration,
+                                      const extension_classification_table& mapping_registry,
+                                      std::vector<classification_worker_state>& worker_states,
+                                      incremental_index_session* index_session,
+                                      const rule_configuration_matcher& rule_matcher,
+                                      live_statistics_exporter* statistics_exporter = nullptr) {
+    bounded_lockfree_queue<discovered_directory_batch> discovery_queue(STREAMING_QUEUE_CAPACITY);
+    parallel_directory_walker directory_walker(runtime_configuration.walker_thread_count);
+    if (!runtime_configuration.destination_directory_path.empty()) {
+        directory_walker.exclude_directory_subtree(runtime_configuration.destination_directory_path);
+    }
+    if (runtime_configuration.metadata_collection_enabled) {
+        directory_walker.enable_metadata_collection(runtime_configuration.io_uring_backend_enabled);
+    }
+    if (index_session != nullptr) directory_walker.attach_incremental_index(index_session);
+    if (statistics_exporter != nullptr) {
+        statistics_exporter->attach_walker(directory_walker);
+        statistics_exporter->attach_queue_depth("discovery", [&discovery_queue] { return discovery_queue.approximate_size(); });
+    }
+    std::thread traversal_thread([&] {
+        traverse_configured_source(directory_walker, runtime_configuration,
+            [&discovery_queue](discovered_directory_batch&& directory_batch) {
+                publish_discovery_batch_in_chunks(std::move(directory_batch), discovery_queue);
+            });
+        discovery_queue.close_queue();
+    });
+    
+    // Classifier workers: private storage, reservation from the walker's projection
+    std::atomic<int> active_classifier_count(static_cast<int>(worker_states.size()));
+    std::vector<std::thread> classifier_thread_collection;
+    for (classification_worker_state& worker_state : worker_states) {
+        classifier_thread_collection.emplace_back([&] {
+            classification_statistics_accumulator published_totals;  // Live distributions; the report scans the store instead
+            discovered_directory_batch directory_batch;
+            while (discovery_queue.dequeue_blocking(directory_batch)) {
+                std::vector<file_classification_entry>& batch_entries = worker_state.batch_entries;
+                batch_entries.clear();
+                worker_state.result_store.reserve_ahead(directory_walker.estimated_total_file_count() / worker_states.size(),
+                                                        directory_batch.filename_count);
+                append_classified_directory_batch(directory_batch.packed_filename_buffer, directory_batch.directory_path,
+                                                  directory_batch.metadata_collection, mapping_registry, batch_entries);
+                if (rule_matcher.has_rules()) {
+                    apply_rule_configuration_to_entries(rule_matcher, directory_batch.directory_path,
+                                                        batch_entries.data(), batch_entries.size());
+                }
+                if (runtime_configuration.content_sniffing_enabled) {
+                    sniff_unclassified_directory_entries(directory_batch.directory_path, batch_entries.data(),
+                                                         batch_entries.size(), worker_state.statistics_accumulator);
+                }
+                // Distributions are taken from the store columns after collection
+                worker_state.result_store.append_entries(batch_entries.data(), batch_entries.size());
+                worker_state.progress_counter.store(worker_state.result_store.size(), std::memory_order_relaxed);
+                if (statistics_exporter != nullptr) {
+                    for (const file_classification_entry& batch_entry : batch_entries) published_totals.record_classified_entry(batch_entry);
+                    worker_state.published_statistics.publish_statistics(published_totals);
+                }
+            }
+            active_classifier_count.fetch_sub(1);
+        });
+    }
+    
+    // Sample worker progress from the reporter thread until every classifier has drained the queue
+    rate_limited_progress_reporter progress_reporter([&] {
+        size_t files_classified = 0;
+        for (const classification_worker_state& worker_state : worker_states) {
+            files_classified += worker_state.progress_counter.load(std::memory_order_relaxed);
+        }
+        display_traversal_progress(files_classified, directory_walker.visited_directory_count());
+    }, !runtime_configuration.quiet_mode_enabled);
+    traversal_thread.join();
+    for (auto& classifier_thread : classifier_thread_collection) classifier_thread.join();
+    progress_reporter.stop_reporting();
+    
+    size_t store_column_bytes = 0;
+    size_t store_heap_bytes = 0;
+    for (const classification_worker_state& worker_state : worker_states) {
+        store_column_bytes += worker_state.result_store.column_byte_count();
+        store_heap_bytes += worker_state.result_store.heap_byte_count();
+    }
+    if (!runtime_configuration.quiet_mode_enabled) {
+        display_traversal_progress(directory_walker.discovered_file_count(), directory_walker.visited_directory_count());
+        std::cout << "\nDirectories Visited: " << directory_walker.visited_directory_count()
+                  << " | Traversal Errors: " << directory_walker.traversal_error_count()
+                  << " | Walker Threads: " << directory_walker.resolved_thread_count()
+                  << " | Classifier Threads: " << worker_states.size();
+        std::cout << "\nResult Store: " << store_column_bytes << " column bytes, " << store_heap_bytes << " string heap bytes";
+        display_metadata_backend(runtime_configuration, directory_walker);
+        display_walker_concurrency(directory_walker);
+    }
+    if (index_session != nullptr) {
+        index_session->skipped_directory_count = directory_walker.skipped_directory_count();
+        index_session->unchanged_file_count = directory_walker.unchanged_file_count();
+    }
+    if (statistics_exporter != nullptr) statistics_exporter->detach_pipeline();
+}
+
+/**
+ * xxh64_content_hasher - Incremental XXH64 over file content
+ * Little-endian reads, matching the packed key layout used elsewhere; equal
+ * byte streams give equal digests regardless of how they are split into updates
+ */
+class xxh64_content_hasher {
+public:
+    explicit xxh64_content_hasher(uint64_t seed_value = 0)
+        : lane_accumulators{seed_value + PRIME_1 + PRIME_2, seed_value + PRIME_2, seed_value, seed_value - PRIME_1},
+          hash_seed(seed_value) {}
+    
+    void update(const void* input_bytes, size_t input_length) {
+        const unsigned char* input_cursor = static_cast<const unsigned char*>(input_bytes);
+        total_length += input_length;
+        if (buffered_length + input_length < STRIPE_LENGTH) {
+            std::memcpy(stripe_buffer + buffered_length, input_cursor, input_length);
+            buffered_length += input_length;
+            return;
+        }
+        if (buffered_length > 0) {
+            size_t fill_length = STRIPE_LENGTH - buffered_length;
+            std::memcpy(stripe_buffer + buffered_length, input_cursor, fill_length);
+            consume_stripe(stripe_buffer);
+            input_cursor += fill_length;
+            input_length -= fill_length;
+            buffered_length = 0;
+        }
+        while (input_length >= STRIPE_LENGTH) {
+            consume_stripe(input_cursor);
+            input_cursor += STRIPE_LENGTH;
+            input_length -= STRIPE_LENGTH;
+        }
+        std::memcpy(stripe_buffer, input_cursor, input_length);
+        buffered_length = input_length;
+    }
+    
+    uint64_t digest() const {
+        uint64_t hash_value;
+        if (total_length >= STRIPE_LENGTH) {
+            hash_value = rotate_left(lane_accumulators[0], 1) + rotate_left(lane_accumulators[1], 7) +
+                         rotate_left(lane_accumulators[2], 12) + rotate_left(lane_accumulators[3], 18);
+            for (uint64_t lane_accumulator : lane_accumulators) {
+                hash_value ^= mix_round(0, lane_accumulator);
+                hash_value = hash_value * PRIME_1 + PRIME_4;
+            }
+        } else {
+            hash_value = hash_seed + PRIME_5;
+        }
+        hash_value += total_length;
+        
+        const unsigned char* tail_cursor = stripe_buffer;
+        size_t tail_length = buffered_length;
+        for (; tail_length >= 8; tail_cursor += 8, tail_length -= 8) {
+            hash_value ^= mix_round(0, read_little_endian<uint64_t>(tail_cursor));
+            hash_value = rotate_left(hash_value, 27) * PRIME_1 + PRIME_4;
+        }
+        if (tail_length >= 4) {
+            hash_value ^= static_cast<uint64_t>(read_little_endian<uint32_t>(tail_cursor)) * PRIME_1;
+            hash_value = rotate_left(hash_value, 23) * PRIME_2 + PRIME_3;
+            tail_cursor += 4;
+            tail_length -= 4;
+        }
+        for (; tail_length > 0; ++tail_cursor, --tail_length) {
+            hash_value ^= *tail_cursor * PRIME_5;
+            hash_value = rotate_left(hash_value, 11) * PRIME_1;
+        }
+        
+        hash_value ^= hash_value >> 33;
+        hash_value *= PRIME_2;
+        hash_value ^= hash_value >> 29;
+        hash_value *= PRIME_3;
+        hash_value ^= hash_value >> 32;
+        return hash_value;
+    }
+
+private:
+    static constexpr uint64_t PRIME_1 = 11400714785074694791ULL;
+    static constexpr uint64_t PRIME_2 = 14029467366897019727ULL;
+    static constexpr uint64_t PRIME_3 = 1609587929392839161ULL;
+    static constexpr uint64_t PRIME_4 = 9650029242287828579ULL;
+    static constexpr uint64_t PRIME_5 = 2870177450012600261ULL;
+    static constexpr size_t STRIPE_LENGTH = 32;
+    
+    static uint64_t rotate_left(uint64_t value, int shift) { return (value << shift) | (value >> (64 - shift)); }
+    static uint64_t mix_round(uint64_t accumulator, uint64_t input_lane) {
+        accumulator += input_lane * PRIME_2;
+        return rotate_left(accumulator, 31) * PRIME_1;
+    }
+    template <typename integer_type>
+    static integer_type read_little_endian(const unsigned char* input_cursor) {
+        integer_type lane_value;
+        std::memcpy(&lane_value, input_cursor, sizeof(lane_value));
+        return lane_value;
+    }
+    void consume_stripe(const unsigned char* stripe_bytes) {
+        for (int lane_index = 0; lane_index < 4; ++lane_index) {
+            lane_accumulators[lane_index] = mix_round(lane_accumulators[lane_index],
+                                                      read_little_endian<uint64_t>(stripe_bytes + lane_index * 8));
+        }
+    }
+    
+    uint64_t lane_accumulators[4];            // Four parallel stripe lanes
+    uint64_t hash_seed;                       // Seed for inputs shorter than one stripe
+    uint64_t total_length = 0;                // Bytes consumed so far
+    unsigned char stripe_buffer[STRIPE_LENGTH];  // Bytes waiting for a complete stripe
+    size_t buffered_length = 0;               // Valid bytes in stripe_buffer
+};
+
+/**
+ * verify_content_hasher_vectors - Checks xxh64_content_hasher against the XXH64 reference
+ * Inputs are prefixes of the xxhsum sanity buffer (which cover the short
+ * tail, the 4/8-byte tails and the 32-byte stripe path) with seed 0 and
+ * seed PRIME32. Every input is hashed in one update and again in 7-byte
+ * updates. Prints one line per mismatch to stderr; returns true when all match
+ */
+bool verify_content_hasher_vectors(size_t& checked_vector_count) {
+    struct reference_vector {
+        size_t input_length;                  // Prefix of the sanity buffer
+        uint64_t seed_value;
+        uint64_t expected_digest;             // Value published by the reference implementation
+    };
+    const uint64_t SANITY_PRIME_32 = 2654435761ULL;
+    const reference_vector REFERENCE_VECTORS[] = {
+        {0, 0, 0xEF46DB3751D8E999ULL},   {0, SANITY_PRIME_32, 0xAC75FDA2929B17EFULL},
+        {1, 0, 0xE934A84ADB052768ULL},   {1, SANITY_PRIME_32, 0x5014607643A9B4C3ULL},
+        {4, 0, 0x9136A0DCA57457EEULL},   {14, 0, 0x8282DCC4994E35C8ULL},
+        {14, SANITY_PRIME_32, 0xC3BD6BF63DEB6DF0ULL}, {222, 0, 0xB641AE8CB691C174ULL},
+        {222, SANITY_PRIME_32, 0x20CB8AB7AE10C14AULL},
+    };
+    
+    // Sanity buffer of xxhsum: top byte of a multiplicative sequence
+    unsigned char sanity_buffer[222];
+    uint64_t byte_generator = SANITY_PRIME_32;
+    for (unsigned char& buffer_byte : sanity_buffer) {
+        buffer_byte = static_cast<unsigned char>(byte_generator >> 56);
+        byte_generator *= 11400714785074694797ULL;
+    }
+    
+    bool all_vectors_match = true;
+    checked_vector_count = 0;
+    for (const reference_vector& current_vector : REFERENCE_VECTORS) {
+        xxh64_content_hasher single_update_hasher(current_vector.seed_value);
+        single_update_hasher.update(sanity_buffer, current_vector.input_length);
+        xxh64_content_hasher split_update_hasher(current_vector.seed_value);
+        for (size_t chunk_start = 0; chunk_start < current_vector.input_length; chunk_start += 7) {
+            split_update_hasher.update(sanity_buffer + chunk_start, std::min<size_t>(7, current_vector.input_length - chunk_start));
+        }
+        const uint64_t computed_digests[2] = {single_update_hasher.digest(), split_update_hasher.digest()};
+        for (int update_mode = 0; update_mode < 2; ++update_mode) {
+            checked_vector_count++;
+            if (computed_digests[update_mode] == current_vector.expected_digest) continue;
+            all_vectors_match = false;
+            std::cerr << "XXH64 mismatch (" << (update_mode == 0 ? "one update" : "7-byte updates") << "): length "
+                      << current_vector.input_length << ", seed " << current_vector.seed_value << ": got " << std::hex
+                      << computed_digests[update_mode] << ", expected " << current_vector.expected_digest << std::dec << "\n";
+        }
+    }
+    return all_vectors_match;
+}
+
+// Outcome of the duplicate detection stage
+struct duplicate_detection_summary {
+    size_t size_candidate_files = 0;          // Files sharing their size with another file
+    size_t full_hashed_files = 0;             // Files hashed in full
+    size_t duplicate_group_count = 0;         // Groups of identical files
+    size_t redundant_file_count = 0;          // Copies beyond the first of each group
+    uint64_t redundant_bytes = 0;             // Bytes held by redundant copies
+    uint64_t bytes_read = 0;                  // Content bytes read across both hash tiers
+};
+
+/**
+ * hash_file_content - Hashes one tier of a file's content
+ * The partial tier hashes the first and last DUPLICATE_PARTIAL_HASH_LENGTH
+ * bytes (the whole file when that covers it); the full tier hashes everything,
+ * through mmap on POSIX. Returns false when the file cannot be read as sized,
+ * including when it was resized since the walker recorded file_size_bytes
+ */
+bool hash_file_content(const file_classification_entry& file_entry, bool full_content, uint64_t& content_hash, uint64_t& bytes_read) {
+    std::string file_path(file_entry.source_directory_path);
+    file_path += '/';
+    file_path += file_entry.filename_identifier;
+    uint64_t file_size = file_entry.file_size_bytes;
+    xxh64_content_hasher content_hasher(file_size);
+    bool partial_covers_file = file_size <= 2 * DUPLICATE_PARTIAL_HASH_LENGTH;
+#if defined(ARTLEST_POSIX_FILE_OPERATIONS)
+    int file_descriptor = ::open(file_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (file_descriptor < 0) return false;
+    // Mapping past a shrunken file's EOF would raise SIGBUS, so the recorded size must still hold
+    struct stat file_status;
+    if (::fstat(file_descriptor, &file_status) != 0 || static_cast<uint64_t>(file_status.st_size) != file_size) {
+        ::close(file_descriptor);
+        return false;
+    }
+    bool hash_succeeded = true;
+    if (!full_content || partial_covers_file) {
+        unsigned char partial_buffer[2 * DUPLICATE_PARTIAL_HASH_LENGTH];
+        size_t head_length = partial_covers_file ? static_cast<size_t>(file_size) : DUPLICATE_PARTIAL_HASH_LENGTH;
+        hash_succeeded = ::pread(file_descriptor, partial_buffer, head_length, 0) == static_cast<ssize_t>(head_length);
+        if (hash_succeeded && !partial_covers_file) {
+            hash_succeeded = ::pread(file_descriptor, partial_buffer + head_length, DUPLICATE_PARTIAL_HASH_LENGTH,
+                                     static_cast<off_t>(file_size - DUPLICATE_PARTIAL_HASH_LENGTH)) ==
+                             static_cast<ssize_t>(DUPLICATE_PARTIAL_HASH_LENGTH);
+            head_length += DUPLICATE_PARTIAL_HASH_LENGTH;
+        }
+        if (hash_succeeded) {
+            content_hasher.update(partial_buffer, head_length);
+            bytes_read += head_length;
+        }
+    } else {
+        void* mapped_content = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+        if (mapped_content == MAP_FAILED) {
+            hash_succeeded = false;
+        } else {
+            ::madvise(mapped_content, file_size, MADV_SEQUENTIAL);
+            content_hasher.update(mapped_content, file_size);
+            bytes_read += file_size;
+            ::munmap(mapped_content, file_size);
+        }
+    }
+    ::close(file_descriptor);
+    if (!hash_succeeded) return false;
+#else
+    std::ifstream file_stream(file_path, std::ios::binary);
+    if (!file_stream) return false;
+    std::vector<char> read_buffer;
+    auto hash_range = [&](uint64_t range_offset, uint64_t range_length) {
+        read_buffer.resize(static_cast<size_t>(std::min<uint64_t>(range_length, COPY_FALLBACK_CHUNK_SIZE)));
+        file_stream.seekg(static_cast<std::streamoff>(range_offset));
+        while (range_length > 0 && file_stream) {
+            size_t chunk_length = static_cast<size_t>(std::min<uint64_t>(range_length, read_buffer.size()));
+            if (!file_stream.read(read_buffer.data(), chunk_length)) return false;
+            content_hasher.update(read_buffer.data(), chunk_length);
+            bytes_read += chunk_length;
+            range_length -= chunk_length;
+        }
+        return range_length == 0;
+    };
+    bool hash_succeeded = (full_content || partial_covers_file)
+        ? hash_range(0, file_size)
+        : hash_range(0, DUPLICATE_PARTIAL_HASH_LENGTH) &&
+          hash_range(file_size - DUPLICATE_PARTIAL_HASH_LENGTH, DUPLICATE_PARTIAL_HASH_LENGTH);
+    if (!hash_succeeded) return false;
+#endif
+    content_hash = content_hasher.digest();
+    return true;
+}
+
+/**
+ * detect_duplicate_entries - Tiered duplicate search over classified entries
+ * Tier 1 groups by size (free: sizes come from the walker's metadata), tier 2
+ * hashes head and tail of size-group members, tier 3 hashes full content of
+ * files still tied after tier 2. Each hash tier runs on worker_thread_count
+ * threads that pull candidates from a shared cursor, so only files that could
+ * still be duplicates are ever read. Members of a final group share a
+ * duplicate_group_identifier; all but the first in entry order are flagged
+ * redundant_duplicate. Empty files and unreadable files are never grouped
+ */
+duplicate_detection_summary detect_duplicate_entries(std::vector<file_classification_entry>& entry_collection, int worker_thread_count) {
+    duplicate_detection_summary detection_summary;
+    
+    // Runs hash_candidate(candidate_index) for every candidate on the worker threads
+    auto run_hash_tier = [worker_thread_count](size_t candidate_count, const std::function<void(size_t)>& hash_candidate) {
+        std::atomic<size_t> candidate_cursor(0);
+        auto drain_candidates = [&] {
+            for (size_t candidate_index = candidate_cursor.fetch_add(1, std::memory_order_relaxed); candidate_index < candidate_count;
+                 candidate_index = candidate_cursor.fetch_add(1, std::memory_order_relaxed)) {
+                hash_candidate(candidate_index);
+            }
+        };
+        size_t tier_thread_count = std::min<size_t>(std::max(worker_thread_count, 1), candidate_count);
+        std::vector<std::thread> tier_threads;
+        for (size_t thread_index = 1; thread_index < tier_thread_count; ++thread_index) tier_threads.emplace_back(drain_candidates);
+        drain_candidates();
+        for (std::thread& tier_thread : tier_threads) tier_thread.join();
+    };
+    
+    // Keeps only members of runs (under equal_keys) of length two or more
+    auto retain_tied_runs = [](std::vector<uint32_t>& candidate_indices, auto equal_keys) {
+        size_t retained_count = 0;
+        for (size_t run_start = 0; run_start < candidate_indices.size();) {
+            size_t run_end = run_start + 1;
+            while (run_end < candidate_indices.size() && equal_keys(candidate_indices[run_start], candidate_indices[run_end])) run_end++;
+            if (run_end - run_start >= 2) {
+                for (size_t member_index = run_start; member_index < run_end; ++member_index) {
+                    candidate_indices[retained_count++] = candidate_indices[member_index];
+                }
+            }
+            run_start = run_end;
+        }
+        candidate_indices.resize(retained_count);
+    };
+    
+    // Tier 1: equal sizes (entry order breaks ties so the first copy stays first)
+    std::vector<uint32_t> candidate_indices;
+    for (size_t entry_index = 0; entry_index < entry_collection.size(); ++entry_index) {
+        if (entry_collection[entry_index].file_size_bytes > 0) candidate_indices.push_back(static_cast<uint32_t>(entry_index));
+    }
+    std::sort(candidate_indices.begin(), candidate_indices.end(), [&](uint32_t left_index, uint32_t right_index) {
+        uint64_t left_size = entry_collection[left_index].file_size_bytes;
+        uint64_t right_size = entry_collection[right_index].file_size_bytes;
+        return left_size != right_size ? left_size < right_size : left_index < right_index;
+    });
+    retain_tied_runs(candidate_indices, [&](uint32_t left_index, uint32_t right_index) {
+        return entry_collection[left_index].file_size_bytes == entry_collection[right_index].file_size_bytes;
+    });
+    detection_summary.size_candidate_files = candidate_indices.size();
+    
+    // Tiers 2 and 3: hash, then keep only entries still tied on (size, hash)
+    std::vector<uint64_t> content_hashes(entry_collection.size(), 0);
+    std::vector<uint8_t> hash_valid(entry_collection.size(), 0);
+    std::atomic<uint64_t> bytes_read(0);
+    auto size_then_hash_less = [&](uint32_t left_index, uint32_t right_index) {
+        const file_classification_entry& left_entry = entry_collection[left_index];
+        const file_classification_entry& right_entry = entry_collection[right_index];
+        if (left_entry.file_size_bytes != right_entry.file_size_bytes) return left_entry.file_size_bytes < right_entry.file_size_bytes;
+        if (content_hashes[left_index] != content_hashes[right_index]) return content_hashes[left_index] < content_hashes[right_index];
+        return left_index < right_index;
+    };
+    auto size_and_hash_equal = [&](uint32_t left_index, uint32_t right_index) {
+        return entry_collection[left_index].file_size_bytes == entry_collection[right_index].file_size_bytes &&
+               content_hashes[left_index] == content_hashes[right_index];
+    };
+    auto hash_and_regroup = [&](std::vector<uint32_t>& tier_indices, bool full_content) {
+        run_hash_tier(tier_indices.size(), [&](size_t candidate_index) {
+            uint32_t entry_index = tier_indices[candidate_index];
+            uint64_t candidate_bytes_read = 0;
+            hash_valid[entry_index] = hash_file_content(entry_collection[entry_index], full_content,
+                                                        content_hashes[entry_index], candidate_bytes_read);
+            bytes_read.fetch_add(candidate_bytes_read, std::memory_order_relaxed);
+        });
+        tier_indices.erase(std::remove_if(tier_indices.begin(), tier_indices.end(),
+                                          [&](uint32_t entry_index) { return !hash_valid[entry_index]; }),
+                           tier_indices.end());
+        std::sort(tier_indices.begin(), tier_indices.end(), size_then_hash_less);
+        retain_tied_runs(tier_indices, size_and_hash_equal);
+    };
+    
+    hash_and_regroup(candidate_indices, false);
+    
+    // Files no larger than both partial windows were hashed in full already
+    std::vector<uint32_t> confirmed_indices;
+    std::vector<uint32_t> full_hash_indices;
+    for (uint32_t entry_index : candidate_indices) {
+        (entry_collection[entry_index].file_size_bytes <= 2 * DUPLICATE_PARTIAL_HASH_LENGTH ? confirmed_indices : full_hash_indices)
+            .push_back(entry_index);
+    }
+    detection_summary.full_hashed_files = full_hash_indices.size();
+    hash_and_regroup(full_hash_indices, true);
+    confirmed_indices.insert(confirmed_indices.end(), full_hash_indices.begin(), full_hash_indices.end());
+    std::sort(confirmed_indices.begin(), confirmed_indices.end(), size_then_hash_less);
+    
+    // Number the groups; the earliest entry of each group is the copy that is kept
+    for (size_t run_start = 0; run_start < confirmed_indices.size();) {
+        size_t run_end = run_start + 1;
+        while (run_end < confirmed_indices.size() && size_and_hash_equal(confirmed_indices[run_start], confirmed_indices[run_end])) run_end++;
+        uint32_t group_identifier = static_cast<uint32_t>(++detection_summary.duplicate_group_count);
+        for (size_t member_index = run_start; member_index < run_end; ++member_index) {
+            file_classification_entry& member_entry = entry_collection[confirmed_indices[member_index]];
+            member_entry.duplicate_group_identifier = group_identifier;
+            if (member_index == run_start) continue;
+            member_entry.redundant_duplicate = true;
+            detection_summary.redundant_file_count++;
+            detection_summary.redundant_bytes += member_entry.file_size_bytes;
+        }
+        run_start = run_end;
+    }
+    detection_summary.bytes_read = bytes_read.load();
+    return detection_summary;
+}
+
+/**
+ * display_duplicate_detection_summary - Reports duplicate groups and tier work
+ */
+void display_duplicate_detection_summary(const duplicate_detection_summary& detection_summary) {
+    std::cout << "\nDuplicate Detection: " << detection_summary.duplicate_group_count << " groups, "
+              << detection_summary.redundant_file_count << " redundant copies ("
+              << detection_summary.redundant_bytes << " bytes); "
+              << detection_summary.size_candidate_files << " size matches head/tail hashed, "
+              << detection_summary.full_hashed_files << " hashed in full, "
+              << detection_summary.bytes_read << " bytes read\n";
+}
+
+/**
+ * benchmark_measurement - Timings of one benchmark across repetitions
+ */
+struct benchmark_measurement {
+    std::string benchmark_name;               // Stage under test
+    size_t operations_per_repetition = 0;     // Names, entries or files handled per repetition
+    std::vector<double> repetition_nanoseconds;  // Wall time of every repetition
+};
+
+volatile uint64_t benchmark_result_sink = 0;  // Keeps benchmarked results observable to the optimizer
+
+/**
+ * run_stage_benchmark - Times repetitions of one stage
+ * stage_function(repetition_index) performs one repetition and returns a
+ * checksum, which is folded into benchmark_result_sink. prepare_function
+ * runs untimed before every repetition (e.g. to restore unsorted input)
+ */
+template <typename stage_function_type, typename prepare_function_type>
+benchmark_measurement run_stage_benchmark(const std::string& benchmark_name, size_t operations_per_repetition, int repetition_count,
+                                          stage_function_type stage_function, prepare_function_type prepare_function) {
+    benchmark_measurement stage_measurement;
+    stage_measurement.benchmark_name = benchmark_name;
+    stage_measurement.operations_per_repetition = operations_per_repetition;
+    for (int repetition_index = 0; repetition_index < repetition_count; ++repetition_index) {
+        prepare_function();
+        auto repetition_start = std::chrono::steady_clock::now();
+        uint64_t repetition_checksum = stage_function(repetition_index);
+        auto repetition_end = std::chrono::steady_clock::now();
+        benchmark_result_sink = benchmark_result_sink + repetition_checksum;
+        stage_measurement.repetition_nanoseconds.push_back(static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(repetition_end - repetition_start).count()));
+    }
+    return stage_measurement;
+}
+
+template <typename stage_function_type>
+benchmark_measurement run_stage_benchmark(const std::string& benchmark_name, size_t operations_per_repetition, int repetition_count,
+                                          stage_function_type stage_function) {
+    return run_stage_benchmark(benchmark_name, operations_per_repetition, repetition_count, stage_function, [] {});
+}
+
+/**
+ * generate_benchmark_corpus - Builds the deterministic synthetic filename corpus
+ * Names come from the --generate distribution parameters, so a corpus can be
+ * skewed the same way as the datasets used for capacity planning
+ */
+void generate_benchmark_corpus(synthetic_filename_generator& name_generator, size_t distinct_name_count,
+                               std::string& packed_filename_buffer, std::vector<std::string_view>& corpus_names) {
+    packed_filename_buffer.clear();
+    name_generator.append_packed_names(packed_filename_buffer, distinct_name_count);
+    
+    // Views are taken after the buffer stops growing
+    corpus_names.clear();
+    corpus_names.reserve(distinct_name_count);
+    std::string_view packed_filenames = packed_filename_buffer;
+    while (!packed_filenames.empty()) {
+        size_t separator_position = packed_filenames.find(PACKED_FILENAME_SEPARATOR);
+        corpus_names.push_back(packed_filenames.substr(0, separator_position));
+        packed_filenames.remove_prefix(separator_position + 1);
+    }
+}
+
+/**
+ * append_benchmark_json - Serializes one measurement as a JSON object
+ * Reports best and median repetition since the minimum is the most stable
+ * regression signal and the median shows run-to-run noise
+ */
+void append_benchmark_json(std::ostringstream& json_output, const benchmark_measurement& stage_measurement) {
+    std::vector<double> sorted_nanoseconds = stage_measurement.repetition_nanoseconds;
+    std::sort(sorted_nanoseconds.begin(), sorted_nanoseconds.end());
+    double best_nanoseconds = sorted_nanoseconds.front();
+    double median_nanoseconds = sorted_nanoseconds[sorted_nanoseconds.size() / 2];
+    double operation_count = static_cast<double>(std::max<size_t>(stage_measurement.operations_per_repetition, 1));
+    json_output << "{\"name\": \"" << stage_measurement.benchmark_name << "\""
+                << ", \"operations\": " << stage_measurement.operations_per_repetition
+                << ", \"repetitions\": " << sorted_nanoseconds.size()
+                << std::fixed << std::setprecision(3)
+                << ", \"best_ns_per_op\": " << best_nanoseconds / operation_count
+                << ", \"median_ns_per_op\": " << median_nanoseconds / operation_count
+                << std::setprecision(0)
+                << ", \"best_ops_per_second\": " << (best_nanoseconds > 0 ? operation_count * 1e9 / best_nanoseconds : 0.0)
+                << ", \"best_total_ns\": " << best_nanoseconds << "}";
+}
+
+/**
+ * execute_benchmark_suite - Micro and macro benchmarks with JSON output
+ * Micro benchmarks time each classification stage over a synthetic corpus of
+ * --bench-names names (distinct names are capped and cycled beyond
+ * BENCHMARK_DISTINCT_NAME_LIMIT; the sort and statistics phases hold one entry
+ * per name). The macro benchmark walks and classifies a directory tree end to
+ * end: --source when given, otherwise a generated temporary tree. Only JSON is
+ * written to stdout so results can be diffed or tracked in CI
+ */
+void execute_benchmark_suite(const execution_configuration_parameters& runtime_configuration,
+                             const extension_classification_table& mapping_registry,
+                             const rule_configuration_matcher& rule_matcher) {
+    size_t corpus_name_count = runtime_configuration.benchmark_name_count;
+    int repetition_count = runtime_configuration.throughput_repeat_count > 0 ? runtime_configuration.throughput_repeat_count
+                                                                               : BENCHMARK_DEFAULT_REPETITIONS;
+    synthetic_filename_generator name_generator(runtime_configuration.synthetic_zipf_exponent,
+                                                runtime_configuration.synthetic_miss_rate, runtime_configuration.synthetic_seed);
+    std::string packed_filename_buffer;
+    std::vector<std::string_view> corpus_names;
+    generate_benchmark_corpus(name_generator, std::min(corpus_name_count, BENCHMARK_DISTINCT_NAME_LIMIT), packed_filename_buffer, corpus_names);
+    size_t distinct_name_count = corpus_names.size();
+    std::vector<benchmark_measurement> micro_measurements;
+    
+    micro_measurements.push_back(run_stage_benchmark("extract_file_extension_identifier", corpus_name_count, repetition_count, [&](int) {
+        char extension_buffer[EXTENSION_BUFFER_CAPACITY];
+        uint64_t length_checksum = 0;
+        for (size_t name_index = 0; name_index < corpus_name_count; ++name_index) {
+            length_checksum += extract_file_extension_identifier(corpus_names[name_index % distinct_name_count], extension_buffer,
+                                                                 mapping_registry.longest_extension_length()).size();
+        }
+        return length_checksum;
+    }));
+    micro_measurements.push_back(run_stage_benchmark("determine_classification_category", corpus_name_count, repetition_count, [&](int) {
+        uint64_t category_checksum = 0;
+        for (size_t name_index = 0; name_index < corpus_name_count; ++name_index) {
+            category_checksum += determine_classification_category(corpus_names[name_index % distinct_name_count], mapping_registry);
+        }
+        return category_checksum;
+    }));
+    micro_measurements.push_back(run_stage_benchmark("calculate_processing_priority", corpus_name_count, repetition_count, [&](int repetition_index) {
+        uint64_t priority_checksum = 0;
+        for (size_t operation_index = 0; operation_index < corpus_name_count; ++operation_index) {
+            priority_checksum += calculate_processing_priority(static_cast<classification_category_identifier>(
+                (operation_index + repetition_index) % CLASSIFICATION_CATEGORY_COUNT));
+        }
+        return priority_checksum;
+    }));
+    std::vector<packed_filename_classification> kernel_output;
+    kernel_output.reserve(distinct_name_count);
+    micro_measurements.push_back(run_stage_benchmark(std::string("classify_packed_filename_batch[") +
+                                                     select_packed_classification_kernel().kernel_name + "]",
+                                                     corpus_name_count, repetition_count, [&](int) {
+        uint64_t category_checksum = 0;
+        for (size_t names_done = 0; names_done < corpus_name_count; names_done += distinct_name_count) {
+            kernel_output.clear();
+            classify_packed_filename_batch(packed_filename_buffer, mapping_registry, kernel_output);
+            category_checksum += kernel_output.size();
+        }
+        return category_checksum;
+    }));
+    if (rule_matcher.has_rules()) {
+        micro_measurements.push_back(run_stage_benchmark("rule_configuration_matcher", corpus_name_count, repetition_count, [&](int) {
+            uint64_t match_checksum = 0;
+            classification_category_identifier rule_category;
+            for (size_t name_index = 0; name_index < corpus_name_count; ++name_index) {
+                match_checksum += rule_matcher.match_entry(corpus_names[name_index % distinct_name_count], name_index & 0xFFFF,
+                                                           rule_configuration_matcher::NO_RULE_MATCH, rule_category);
+            }
+            return match_checksum;
+        }));
+    }
+    
+    // Sort and statistics phases over one entry per corpus name
+    std::vector<file_classification_entry> unsorted_entries;
+    unsorted_entries.reserve(corpus_name_count);
+    for (size_t name_index = 0; name_index < corpus_name_count; ++name_index) {
+        unsorted_entries.push_back(classify_filename_entry(corpus_names[name_index % distinct_name_count], mapping_registry));
+    }
+    std::vector<file_classification_entry> sorting_entries;
+    micro_measurements.push_back(run_stage_benchmark("sort_entries_by_processing_priority", corpus_name_count, repetition_count,
+        [&](int) {
+            sort_entries_by_processing_priority(sorting_entries);
+            return static_cast<uint64_t>(sorting_entries.front().processing_priority);
+        },
+        [&] { sorting_entries = unsorted_entries; }));
+    micro_measurements.push_back(run_stage_benchmark("statistics_accumulation", corpus_name_count, repetition_count, [&](int) {
+        classification_statistics_accumulator statistics_accumulator;
+        for (const file_classification_entry& current_entry : unsorted_entries) statistics_accumulator.record_classified_entry(current_entry);
+        classification_statistics_accumulator merged_statistics;
+        merged_statistics.merge_statistics(statistics_accumulator);
+        uint64_t distribution_checksum = merged_statistics.total_files_processed + merged_statistics.total_bytes_observed;
+        for (int category_index = 0; category_index < CLASSIFICATION_CATEGORY_COUNT; ++category_index) {
+            distribution_checksum = distribution_checksum * 31 + merged_statistics.category_distribution_metrics[category_index];
+        }
+        for (int priority_level = 0; priority_level <= MAXIMUM_PRIORITY_LEVEL; ++priority_level) {
+            distribution_checksum = distribution_checksum * 31 + merged_statistics.priority_level_distribution[priority_level];
+        }
+        return distribution_checksum;
+    }));
+    
+    // The same sort and statistics over the columnar result store
+    classification_result_store unsorted_store;
+    unsorted_store.append_entries(unsorted_entries.data(), unsorted_entries.size());
+    classification_result_store sorting_store;
+    micro_measurements.push_back(run_stage_benchmark("result_store_priority_sort", corpus_name_count, repetition_count,
+        [&](int) {
+            sorting_store.sort_by_processing_priority();
+            return static_cast<uint64_t>(sorting_store.entry_at(0).processing_priority);
+        },
+        [&] { sorting_store = unsorted_store; }));
+    micro_measurements.push_back(run_stage_benchmark("result_store_statistics_scan", corpus_name_count, repetition_count, [&](int) {
+        classification_statistics_accumulator statistics_accumulator;
+        unsorted_store.accumulate_statistics(statistics_accumulator);
+        uint64_t distribution_checksum = statistics_accumulator.total_files_processed + statistics_accumulator.total_bytes_observed;
+        for (int category_index = 0; category_index < CLASSIFICATION_CATEGORY_COUNT; ++category_index) {
+            distribution_checksum = distribution_checksum * 31 + statistics_accumulator.category_distribution_metrics[category_index];
+        }
+        for (int priority_level = 0; priority_level <= MAXIMUM_PRIORITY_LEVEL; ++priority_level) {
+            distribution_checksum = distribution_checksum * 31 + statistics_accumulator.priority_level_distribution[priority_level];
+        }
+        return distribution_checksum;
+    }));
+    sorting_store = classification_result_store();
+    unsorted_store = classification_result_store();
+    std::vector<file_classification_entry>().swap(sorting_entries);
+    std::vector<file_classification_entry>().swap(unsorted_entries);
+    
+    // Macro benchmark: walk and classify a real tree on the walker threads
+    bool generated_tree = runtime_configuration.source_directory_path.empty();
+    std::string benchmark_tree_path = runtime_configuration.source_directory_path;
+    if (generated_tree) {
+        std::error_code filesystem_error;
+        benchmark_tree_path = (std::filesystem::temp_directory_path(filesystem_error) /
+            ("artlest-bench-" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()))).string();
+        synthetic_tree_summary tree_summary;
+        std::string error_message;
+        if (!write_synthetic_directory_tree(benchmark_tree_path, BENCHMARK_TREE_FILE_COUNT, 1, BENCHMARK_TREE_FANOUT,
+                                            name_generator, tree_summary, error_message)) {
+            std::error_code removal_error;
+            std::filesystem::remove_all(benchmark_tree_path, removal_error);
+            benchmark_tree_path.clear();
+        }
+    }
+    benchmark_measurement macro_measurement;
+    size_t macro_directory_count = 0;
+    int macro_thread_count = 0;
+    if (!benchmark_tree_path.empty()) {
+        std::atomic<size_t> classified_file_count(0);
+        macro_measurement = run_stage_benchmark("walk_and_classify", 0, repetition_count, [&](int) {
+            classified_file_count.store(0);
+            parallel_directory_walker directory_walker(runtime_configuration.walker_thread_count);
+            if (runtime_configuration.metadata_collection_enabled) {
+                directory_walker.enable_metadata_collection(runtime_configuration.io_uring_backend_enabled);
+            }
+            directory_walker.traverse_directory_tree(benchmark_tree_path, [&](discovered_directory_batch&& directory_batch) {
+                thread_local std::vector<file_classification_entry> batch_entries;
+                batch_entries.clear();
+                append_classified_directory_batch(directory_batch.packed_filename_buffer, directory_batch.directory_path,
+                                                  directory_batch.metadata_collection, mapping_registry, batch_entries);
+                if (rule_matcher.has_rules()) {
+                    apply_rule_configuration_to_entries(rule_matcher, directory_batch.directory_path, batch_entries.data(), batch_entries.size());
+                }
+                classified_file_count.fetch_add(batch_entries.size(), std::memory_order_relaxed);
+            });
+            macro_directory_count = directory_walker.visited_directory_count();
+            macro_thread_count = directory_walker.resolved_thread_count();
+            return static_cast<uint64_t>(classified_file_count.load());
+        });
+        macro_measurement.operations_per_repetition = classified_file_count.load();
+    }
+    if (generated_tree && !benchmark_tree_path.empty()) {
+        std::error_code removal_error;
+        std::filesystem::remove_all(benchmark_tree_path, removal_error);
+    }
+    
+    std::ostringstream json_output;
+    json_output << "{\n  \"benchmark_suite\": \"artlest-file-classifier\",\n"
+                << "  \"corpus_names\": " << corpus_name_count << ",\n"
+                << "  \"distinct_names\": " << distinct_name_count << ",\n"
+                << "  \"repetitions\": " << repetition_count << ",\n"
+                << "  \"batch_kernel\": \"" << select_packed_classification_kernel().kernel_name << "\",\n"
+                << "  \"rule_count\": " << rule_matcher.rule_count() << ",\n"
+                << "  \"micro\": [\n";
+    for (size_t measurement_index = 0; measurement_index < micro_measurements.size(); ++measurement_index) {
+        json_output << "    ";
+        append_benchmark_json(json_output, micro_measurements[measurement_index]);
+        json_output << (measurement_index + 1 < micro_measurements.size() ? ",\n" : "\n");
+    }
+    json_output << "  ],\n  \"macro\": ";
+    if (macro_measurement.repetition_nanoseconds.empty()) {
+        json_output << "null\n}\n";
+    } else {
+        json_output << "{\"tree_generated\": " << (generated_tree ? "true" : "false")
+                    << ", \"files\": " << macro_measurement.operations_per_repetition
+                    << ", \"directories\": " << macro_directory_count
+                    << ", \"walker_threads\": " << macro_thread_count << ", \"result\": ";
+        append_benchmark_json(json_output, macro_measurement);
+        json_output << "}\n}\n";
+    }
+    std::cout << json_output.str();
+}
+
+/**
+ * open_incremental_index_session - Loads the previous index of an incremental run
+ * Returns nullptr when no index was requested; an unreadable or mismatching
+ * index is reported and replaced by an empty one, which makes this a full run
+ */
+std::unique_ptr<incremental_index_session> open_incremental_index_session(const execution_configuration_parameters& runtime_configuration) {
+    if (runtime_configuration.incremental_index_path.empty()) return nullptr;
+    std::unique_ptr<incremental_index_session> index_session(new incremental_index_session());
+    index_session->file_moves_enabled = !runtime_configuration.destination_directory_path.empty();
+    std::string error_message;
+    if (!index_session->previous_index.load_index_file(runtime_configuration.incremental_index_path,
+                                                       index_session->file_moves_enabled, error_message)) {
+        std::cerr << "Ignoring incremental index " << runtime_configuration.incremental_index_path << ": " << error_message << "\n";
+    }
+    return index_session;
+}
+
+/**
+ * save_incremental_index_session - Persists the index built during this run
+ * Runs after all moves so moved-from source directories are invalidated first;
+ * returns false only when an index was due and could not be saved
+ */
+bool save_incremental_index_session(const execution_configuration_parameters& runtime_configuration,
+                                    incremental_index_session* index_session) {
+    if (index_session == nullptr) return true;
+    if (index_session->file_moves_enabled) index_session->updated_index.invalidate_moved_directories();
+    std::string error_message;
+    bool index_saved = index_session->updated_index.save_index_file(runtime_configuration.incremental_index_path,
+                                                                    index_session->file_moves_enabled, error_message);
+    if (!runtime_configuration.quiet_mode_enabled) {
+        std::cout << "\nIncremental Index: " << index_session->skipped_directory_count << " directories reused, "
+                  << index_session->unchanged_file_count << " unchanged files skipped, ";
+        if (index_saved) {
+            std::cout << index_session->updated_index.directory_record_count() << " directories recorded\n";
+        } else {
+            std::cout << "not saved (" << error_message << ")\n";
+        }
+    }
+    if (!index_saved) {
+        std::cerr << "Cannot save incremental index " << runtime_configuration.incremental_index_path << ": " << error_message << "\n";
+    }
+    return index_saved;
+}
+
+/**
+ * escape_manifest_field - Makes a path safe for one tab-separated manifest field
+ */
+std::string escape_manifest_field(std::string_view field_text) {
+    std::string escaped_field;
+    escaped_field.reserve(field_text.size());
+    for (char field_character : field_text) {
+        if (field_character == '\\') {
+            escaped_field += "\\\\";
+        } else if (field_character == '\t') {
+            escaped_field += "\\t";
+        } else if (field_character == '\n') {
+            escaped_field += "\\n";
+        } else {
+            escaped_field += field_character;
+        }
+    }
+    return escaped_field;
+}
+
+std::string unescape_manifest_field(std::string_view escaped_field) {
+    std::string field_text;
+    field_text.reserve(escaped_field.size());
+    for (size_t character_index = 0; character_index < escaped_field.size(); ++character_index) {
+        char field_character = escaped_field[character_index];
+        if (field_character == '\\' && character_index + 1 < escaped_field.size()) {
+            char escape_code = escaped_field[++character_index];
+            field_character = escape_code == 't' ? '\t' : escape_code == 'n' ? '\n' : escape_code;
+        }
+        field_text += field_character;
+    }
+    return field_text;
+}
+
+// Splits one manifest or report line at tabs
+std::vector<std::string> split_manifest_line(const std::string& manifest_line) {
+    std::vector<std::string> line_fields;
+    size_t field_start = 0;
+    while (true) {
+        size_t field_end = manifest_line.find('\t', field_start);
+        line_fields.push_back(unescape_manifest_field(std::string_view(manifest_line).substr(
+            field_start, field_end == std::string::npos ? std::string::npos : field_end - field_start)));
+        if (field_end == std::string::npos) break;
+        field_start = field_end + 1;
+    }
+    return line_fields;
+}
+
+/**
+ * execute_shard_split - Coordinator step: partitions --source into shard manifests
+ * The top-level subdirectories are the units of work. Each is weighted by its
+ * immediate entry count (one shallow listing, nothing below) and assigned
+ * largest-first to the least loaded shard. Files directly in the root form
+ * one more unit; the shard that owns it walks the root itself with every
+ * other shard's subdirectories excluded, so each directory belongs to exactly
+ * one shard. Manifests hold absolute paths, so nodes must see the tree at the
+ * same mount point
+ */
+bool execute_shard_split(const execution_configuration_parameters& runtime_configuration) {
+    std::error_code filesystem_error;
+    std::string root_directory_path = std::filesystem::weakly_canonical(runtime_configuration.source_directory_path, filesystem_error).string();
+    if (filesystem_error) root_directory_path = runtime_configuration.source_directory_path;
+    
+    // Units: (weight, subdirectory path); an empty path stands for the root's own files
+    std::vector<std::pair<size_t, std::string>> work_units;
+    size_t root_file_count = 0;
+    std::filesystem::directory_iterator root_cursor(root_directory_path, std::filesystem::directory_options::skip_permission_denied,
+                                                    filesystem_error);
+    if (filesystem_error) {
+        std::cerr << "Cannot list " << root_directory_path << ": " << filesystem_error.message() << "\n";
+        return false;
+    }
+    for (const std::filesystem::directory_iterator root_end; root_cursor != root_end; root_cursor.increment(filesystem_error)) {
+        if (filesystem_error) break;
+        std::error_code status_error;
+        std::filesystem::file_status entry_status = root_cursor->symlink_status(status_error);
+        if (status_error) continue;
+        if (std::filesystem::is_directory(entry_status)) {
+            size_t unit_weight = 1;
+            std::error_code listing_error;
+            for (std::filesystem::directory_iterator unit_cursor(root_cursor->path(), std::filesystem::directory_options::skip_permission_denied,
+                                                                 listing_error), unit_end;
+                 !listing_error && unit_cursor != unit_end; unit_cursor.increment(listing_error)) {
+                unit_weight++;
+            }
+            work_units.emplace_back(unit_weight, root_cursor->path().string());
+        } else if (std::filesystem::is_regular_file(entry_status)) {
+            root_file_count++;
+        }
+    }
+    work_units.emplace_back(root_file_count, std::string());
+    std::stable_sort(work_units.begin(), work_units.end(), [](const auto& left_unit, const auto& right_unit) {
+        return left_unit.first > right_unit.first;
+    });
+    
+    // Longest-processing-time assignment to the least loaded shard
+    int shard_count = runtime_configuration.shard_split_count;
+    std::vector<size_t> shard_weights(shard_count, 0);
+    std::vector<std::vector<std::string>> shard_subdirectories(shard_count);
+    int root_owner_shard = 0;
+    for (const auto& work_unit : work_units) {
+        int target_shard = static_cast<int>(std::min_element(shard_weights.begin(), shard_weights.end()) - shard_weights.begin());
+        shard_weights[target_shard] += work_unit.first;
+        if (work_unit.second.empty()) {
+            root_owner_shard = target_shard;
+        } else {
+            shard_subdirectories[target_shard].push_back(work_unit.second);
+        }
+    }
+    
+    std::cout << "╔══════════════════════════════════════════════════════════════╗\n";
+    std::cout << "║                       SHARD PLAN                             ║\n";
+    std::cout << "╠══════════════════════════════════════════════════════════════╣\n";
+    for (int shard_index = 0; shard_index < shard_count; ++shard_index) {
+        std::string manifest_path = runtime_configuration.shard_manifest_prefix + "-" + std::to_string(shard_index) + ".manifest";
+        std::ofstream manifest_stream(manifest_path, std::ios::binary | std::ios::trunc);
+        manifest_stream << SHARD_MANIFEST_MAGIC << "\n";
+        manifest_stream << "root\t" << escape_manifest_field(root_directory_path) << "\n";
+        manifest_stream << "shard\t" << shard_index << "\t" << shard_count << "\n";
+        if (shard_index == root_owner_shard) {
+            manifest_stream << "seed\t" << escape_manifest_field(root_directory_path) << "\n";
+            for (int other_shard = 0; other_shard < shard_count; ++other_shard) {
+                if (other_shard == shard_index) continue;
+                for (const std::string& subdirectory_path : shard_subdirectories[other_shard]) {
+                    manifest_stream << "exclude\t" << escape_manifest_field(subdirectory_path) << "\n";
+                }
+            }
+        } else {
+            for (const std::string& subdirectory_path : shard_subdirectories[shard_index]) {
+                manifest_stream << "seed\t" << escape_manifest_field(subdirectory_path) << "\n";
+            }
+        }
+        manifest_stream.flush();
+        if (!manifest_stream) {
+            std::cerr << "Cannot write shard manifest " << manifest_path << "\n";
+            return false;
+        }
+        std::string shard_summary = std::to_string(shard_subdirectories[shard_index].size()) + " dirs" +
+                                    (shard_index == root_owner_shard ? " + root files" : "") +
+                                    ", ~" + std::to_string(shard_weights[shard_index]) + " entries";
+        std::cout << "║ Shard " << std::left << std::setw(4) << shard_index << std::setw(51) << shard_summary << "║\n";
+    }
+    std::cout << "╠══════════════════════════════════════════════════════════════╣\n";
+    std::cout << "║ Manifests: " << std::setw(50) << (runtime_configuration.shard_manifest_prefix + "-<N>.manifest") << "║\n";
+    std::cout << "╚══════════════════════════════════════════════════════════════╝\n";
+    return true;
+}
+
+/**
+ * load_shard_manifest - Points the run at the subtrees of one shard
+ * Sets the source root, walked seeds and excluded subtrees from the manifest
+ */
+bool load_shard_manifest(execution_configuration_parameters& runtime_configuration, std::string& error_message) {
+    std::ifstream manifest_stream(runtime_configuration.shard_manifest_path, std::ios::binary);
+    std::string manifest_line;
+    if (!manifest_stream || !std::getline(manifest_stream, manifest_line) || manifest_line != SHARD_MANIFEST_MAGIC) {
+        error_message = "not a shard manifest";
+        return false;
+    }
+    while (std::getline(manifest_stream, manifest_line)) {
+        std::vector<std::string> line_fields = split_manifest_line(manifest_line);
+        if (line_fields[0] == "root" && line_fields.size() == 2) {
+            runtime_configuration.source_directory_path = line_fields[1];
+        } else if (line_fields[0] == "shard" && line_fields.size() == 3) {
+            runtime_configuration.shard_label = line_fields[1] + "/" + line_fields[2];
+        } else if (line_fields[0] == "seed" && line_fields.size() == 2) {
+            runtime_configuration.shard_seed_paths.push_back(line_fields[1]);
+        } else if (line_fields[0] == "exclude" && line_fields.size() == 2) {
+            runtime_configuration.shard_excluded_paths.push_back(line_fields[1]);
+        } else if (!manifest_line.empty()) {
+            error_message = "unrecognized line: " + manifest_line;
+            return false;
+        }
+    }
+    if (runtime_configuration.source_directory_path.empty()) {
+        error_message = "missing root line";
+        return false;
+    }
+    return true;
+}
+
+/**
+ * write_shard_report - Saves one node's histograms for --merge-reports
+ * The report holds exactly the counters perform_statistical_analysis reduces,
+ * plus move counters and where the per-entry result manifest was written
+ */
+bool write_shard_report(const execution_configuration_parameters& runtime_configuration,
+                        const classification_statistics_accumulator& statistics_accumulator,
+                        double classification_elapsed_seconds, const file_move_statistics* move_statistics) {
+    std::string temporary_path = runtime_configuration.shard_report_path + ".tmp";
+    {
+        std::ofstream report_stream(temporary_path, std::ios::binary | std::ios::trunc);
+        report_stream << SHARD_REPORT_MAGIC << "\n";
+        report_stream << "shard\t" << escape_manifest_field(runtime_configuration.shard_label.empty()
+                                                                ? runtime_configuration.source_directory_path
+                                                                : runtime_configuration.shard_label) << "\n";
+        report_stream << "files\t" << statistics_accumulator.total_files_processed << "\n";
+        report_stream << "bytes\t" << statistics_accumulator.total_bytes_observed << "\n";
+        report_stream << "sniffed\t" << statistics_accumulator.content_sniffed_files << "\t"
+                      << statistics_accumulator.content_reclassified_files << "\n";
+        for (int category_index = 0; category_index < CLASSIFICATION_CATEGORY_COUNT; ++category_index) {
+            report_stream << "category\t" << CLASSIFICATION_CATEGORY_TABLE[category_index].directory_name << "\t"
+                          << statistics_accumulator.category_distribution_metrics[category_index] << "\n";
+        }
+        for (int priority_level = 1; priority_level <= MAXIMUM_PRIORITY_LEVEL; ++priority_level) {
+            report_stream << "priority\t" << priority_level << "\t" << statistics_accumulator.priority_level_distribution[priority_level] << "\n";
+        }
+        report_stream << "elapsed\t" << std::setprecision(9) << classification_elapsed_seconds << "\n";
+        if (move_statistics != nullptr) {
+            report_stream << "moves\t" << move_statistics->files_renamed << "\t" << move_statistics->files_copied << "\t"
+                          << move_statistics->collision_renames << "\t" << move_statistics->failed_moves << "\t"
+                          << move_statistics->bytes_copied << "\n";
+        }
+        if (runtime_configuration.output_format != RESULT_OUTPUT_TABLE) {
+            report_stream << "results\t" << (runtime_configuration.output_format == RESULT_OUTPUT_BINARY ? "binary" : "tsv") << "\t"
+                          << escape_manifest_field(runtime_configuration.output_file_path) << "\n";
+        }
+        report_stream.flush();
+        if (!report_stream) {
+            std::cerr << "Cannot write shard report " << temporary_path << "\n";
+            return false;
+        }
+    }
+    std::error_code rename_error;
+    std::filesystem::rename(temporary_path, runtime_configuration.shard_report_path, rename_error);
+    if (rename_error) {
+        std::cerr << "Cannot write shard report " << runtime_configuration.shard_report_path << ": " << rename_error.message() << "\n";
+        return false;
+    }
+    return true;
+}
+
+// One report read by --merge-reports
+struct loaded_shard_report {
+    std::string report_path;                  // Report file
+    std::string shard_label;                  // "index/count" or the node's source root
+    classification_statistics_accumulator statistics_accumulator;  // Node histograms
+    double classification_elapsed_seconds = 0.0;  // Node classification wall time
+    bool moves_recorded = false;              // Node moved files
+    file_move_statistics move_statistics;     // Node move counters
+    std::string result_manifest;              // "<format> <path>" of the node's result file, if any
+};
+
+/**
+ * load_shard_report - Parses a report written by write_shard_report
+ */
+bool load_shard_report(const std::string& report_path, loaded_shard_report& shard_report, std::string& error_message) {
+    std::ifstream report_stream(report_path, std::ios::binary);
+    std::string report_line;
+    if (!report_stream || !std::getline(report_stream, report_line) || report_line != SHARD_REPORT_MAGIC) {
+        error_message = "not a shard report";
+        return false;
+    }
+    shard_report.report_path = report_path;
+    classification_statistics_accumulator& statistics_accumulator = shard_report.statistics_accumulator;
+    while (std::getline(report_stream, report_line)) {
+        std::vector<std::string> line_fields = split_manifest_line(report_line);
+        const std::string& record_type = line_fields[0];
+        auto numeric_field = [&line_fields](size_t field_index) {
+            return field_index < line_fields.size() ? std::strtoull(line_fields[field_index].c_str(), nullptr, 10) : 0ULL;
+        };
+        if (record_type == "shard" && line_fields.size() == 2) {
+            shard_report.shard_label = line_fields[1];
+        } else if (record_type == "files") {
+            statistics_accumulator.total_files_processed = static_cast<long long>(numeric_field(1));
+        } else if (record_type == "bytes") {
+            statistics_accumulator.total_bytes_observed = numeric_field(1);
+        } else if (record_type == "sniffed") {
+            statistics_accumulator.content_sniffed_files = static_cast<long long>(numeric_field(1));
+            statistics_accumulator.content_reclassified_files = static_cast<long long>(numeric_field(2));
+        } else if (record_type == "category" && line_fields.size() == 3) {
+            int category_index = 0;
+            while (category_index < CLASSIFICATION_CATEGORY_COUNT &&
+                   line_fields[1] != CLASSIFICATION_CATEGORY_TABLE[category_index].directory_name) {
+                category_index++;
+            }
+            if (category_index == CLASSIFICATION_CATEGORY_COUNT) {
+                error_message = "unknown category " + line_fields[1];
+                return false;
+            }
+            statistics_accumulator.category_distribution_metrics[category_index] = static_cast<long long>(numeric_field(2));
+        } else if (record_type == "priority" && line_fields.size() == 3) {
+            unsigned long long priority_level = numeric_field(1);
+            if (priority_level < 1 || priority_level > MAXIMUM_PRIORITY_LEVEL) {
+                error_message = "invalid priority level " + line_fields[1];
+                return false;
+            }
+            statistics_accumulator.priority_level_distribution[priority_level] = static_cast<long long>(numeric_field(2));
+        } else if (record_type == "elapsed" && line_fields.size() == 2) {
+            shard_report.classification_elapsed_seconds = std::atof(line_fields[1].c_str());
+        } else if (record_type == "moves" && line_fields.size() == 6) {
+            shard_report.moves_recorded = true;
+            shard_report.move_statistics.files_renamed = numeric_field(1);
+            shard_report.move_statistics.files_copied = numeric_field(2);
+            shard_report.move_statistics.collision_renames = numeric_field(3);
+            shard_report.move_statistics.failed_moves = numeric_field(4);
+            shard_report.move_statistics.bytes_copied = numeric_field(5);
+        } else if (record_type == "results" && line_fields.size() == 3) {
+            shard_report.result_manifest = line_fields[1] + " " + line_fields[2];
+        } else if (!report_line.empty()) {
+            error_message = "unrecognized line: " + report_line;
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * display_quiet_run_summary - Prints the single line a --quiet run leaves on stdout
+ */
+void display_quiet_run_summary(const classification_statistics_accumulator& run_statistics,
+                               double classification_elapsed_seconds, const file_move_statistics* executor_statistics) {
+    std::cout << "Classified " << run_statistics.total_files_processed << " files ("
+              << run_statistics.category_distribution_metrics[CATEGORY_MISCELLANEOUS_FILES] << " unmatched) in "
+              << std::fixed << std::setprecision(3) << classification_elapsed_seconds * 1000.0 << " ms";
+    if (executor_statistics != nullptr) {
+        std::cout << " | Moved: " << executor_statistics->files_renamed + executor_statistics->files_copied
+                  << " | Failed: " << executor_statistics->failed_moves;
+    }
+    std::cout << "\n";
+}
+
+/**
+ * display_shard_merge_report - Global report from shard reports alone
+ * Histograms are summed; nodes run side by side, so the slowest node's
+ * elapsed time is the wall time used for global throughput. No file of the
+ * sorted tree is opened
+ */
+void display_shard_merge_report(const execution_configuration_parameters& runtime_configuration,
+                                const std::vector<loaded_shard_report>& shard_reports) {
+    classification_statistics_accumulator merged_statistics;
+    file_move_statistics merged_moves;
+    bool moves_recorded = false;
+    double slowest_shard_seconds = 0.0;
+    bool report_output_enabled = !runtime_configuration.quiet_mode_enabled;
+    
+    if (report_output_enabled) {
+        std::cout << "╔══════════════════════════════════════════════════════════════╗\n";
+        std::cout << "║                   SHARD REPORT MERGE                         ║\n";
+        std::cout << "╠══════════════════════════════════════════════════════════════╣\n";
+    }
+    for (const loaded_shard_report& shard_report : shard_reports) {
+        merged_statistics.merge_statistics(shard_report.statistics_accumulator);
+        slowest_shard_seconds = std::max(slowest_shard_seconds, shard_report.classification_elapsed_seconds);
+        if (shard_report.moves_recorded) {
+            moves_recorded = true;
+            merged_moves.files_renamed += shard_report.move_statistics.files_renamed;
+            merged_moves.files_copied += shard_report.move_statistics.files_copied;
+            merged_moves.collision_renames += shard_report.move_statistics.collision_renames;
+            merged_moves.failed_moves += shard_report.move_statistics.failed_moves;
+            merged_moves.bytes_copied += shard_report.move_statistics.bytes_copied;
+        }
+        if (!report_output_enabled) continue;
+        std::ostringstream shard_summary;
+        shard_summary << shard_report.statistics_accumulator.total_files_processed << " files in "
+                      << std::fixed << std::setprecision(2) << shard_report.classification_elapsed_seconds << " s";
+        std::cout << "║ Shard " << std::left << std::setw(12) << shard_report.shard_label << std::setw(43) << shard_summary.str() << "║\n";
+        if (!shard_report.result_manifest.empty()) {
+            std::cout << "║   Results: " << std::setw(50) << shard_report.result_manifest << "║\n";
+        }
+    }
+    if (!report_output_enabled) {
+        display_quiet_run_summary(merged_statistics, slowest_shard_seconds, moves_recorded ? &merged_moves : nullptr);
+        return;
+    }
+    std::cout << "╚══════════════════════════════════════════════════════════════╝\n";
+    
+    if (moves_recorded) display_move_statistics(merged_moves);
+    display_statistical_analysis_report(merged_statistics, slowest_shard_seconds);
+}
+
+// Cost estimate of a planned move batch
+struct move_plan_summary {
+    size_t planned_renames = 0;               // Moves within one device (metadata only)
+    size_t planned_copies = 0;                // Moves across devices (bytes copied, then unlinked)
+    uint64_t renamed_bytes = 0;               // Bytes moved by renames
+    uint64_t copied_bytes = 0;                // Bytes the cross-device copies must transfer
+    double copy_bandwidth_bytes_per_second = 0.0;  // Measured (or --plan-bandwidth) transfer rate
+    bool bandwidth_measured = false;          // Rate came from reading source files
+    bool device_identity_known = true;        // Devices could be compared
+    double estimated_seconds = 0.0;           // Renames plus copies at the transfer rate
+};
+
+/**
+ * read_path_device_identifier - Device of a path, or of its nearest existing ancestor
+ * A destination that does not exist yet is created on its parent's device
+ */
+bool read_path_device_identifier(const std::string& filesystem_path, uint64_t& device_identifier) {
+#if defined(ARTLEST_POSIX_FILE_OPERATIONS)
+    std::filesystem::path probe_path = std::filesystem::absolute(filesystem_path);
+    while (true) {
+        struct stat path_status;
+        if (::stat(probe_path.c_str(), &path_status) == 0) {
+            device_identifier = static_cast<uint64_t>(path_status.st_dev);
+            return true;
+        }
+        if (!probe_path.has_parent_path() || probe_path.parent_path() == probe_path) return false;
+        probe_path = probe_path.parent_path();
+    }
+#else
+    (void)filesystem_path;
+    (void)device_identifier;
+    return false;
+#endif
+}
+
+/**
+ * measure_copy_read_bandwidth - Sequential read rate over the largest copy candidates
+ * Reads at most PLAN_BANDWIDTH_SAMPLE_BYTES and never writes. Pages already
+ * cached make the figure optimistic, and the destination's write rate is not
+ * measured, so --plan-bandwidth can override the result
+ */
+double measure_copy_read_bandwidth(std::vector<const file_classification_entry*> copy_candidates) {
+    std::sort(copy_candidates.begin(), copy_candidates.end(), [](const file_classification_entry* left_entry,
+                                                                 const file_classification_entry* right_entry) {
+        return left_entry->file_size_bytes > right_entry->file_size_bytes;
+    });
+    std::unique_ptr<char[]> read_buffer(new char[COPY_FALLBACK_CHUNK_SIZE]);
+    uint64_t sampled_bytes = 0;
+    auto sample_start = std::chrono::steady_clock::now();
+    for (const file_classification_entry* candidate_entry : copy_candidates) {
+        if (sampled_bytes >= PLAN_BANDWIDTH_SAMPLE_BYTES) break;
+        std::string file_path(candidate_entry->source_directory_path);
+        file_path += '/';
+        file_path += candidate_entry->filename_identifier;
+        std::ifstream sample_stream(file_path, std::ios::binary);
+        while (sample_stream && sampled_bytes < PLAN_BANDWIDTH_SAMPLE_BYTES) {
+            sample_stream.read(read_buffer.get(), COPY_FALLBACK_CHUNK_SIZE);
+            sampled_bytes += static_cast<uint64_t>(sample_stream.gcount());
+        }
+    }
+    double sample_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - sample_start).count();
+    return sampled_bytes > 0 && sample_seconds > 0.0 ? sampled_bytes / sample_seconds : 0.0;
+}
+
+/**
+ * execute_move_planning - Dry run: prints or saves the moves --destination would make
+ * Each entry is planned as a rename when its directory is on the destination's
+ * device and as a byte copy otherwise; nothing on disk is created or modified.
+ * Final names may still gain a collision suffix when the plan is executed.
+ * Returns false when the plan file cannot be written
+ */
+bool execute_move_planning(const execution_configuration_parameters& runtime_configuration,
+                           const file_classification_entry* entry_collection, size_t entry_count) {
+    move_plan_summary plan_summary;
+    uint64_t destination_device = 0;
+    plan_summary.device_identity_known = read_path_device_identifier(runtime_configuration.destination_directory_path, destination_device);
+    
+    // One stat per source directory; entries of a directory share its device
+    std::unordered_map<std::string_view, bool> directory_requires_copy;
+    std::vector<uint8_t> entry_requires_copy(entry_count, 0);
+    std::vector<const file_classification_entry*> copy_candidates;
+    for (size_t entry_index = 0; entry_index < entry_count; ++entry_index) {
+        const file_classification_entry& planned_entry = entry_collection[entry_index];
+        auto cached_device = directory_requires_copy.find(planned_entry.source_directory_path);
+        if (cached_device == directory_requires_copy.end()) {
+            uint64_t source_device = 0;
+            bool cross_device = plan_summary.device_identity_known &&
+                                read_path_device_identifier(std::string(planned_entry.source_directory_path), source_device) &&
+                                source_device != destination_device;
+            cached_device = directory_requires_copy.emplace(planned_entry.source_directory_path, cross_device).first;
+        }
+        entry_requires_copy[entry_index] = cached_device->second;
+        if (cached_device->second) {
+            plan_summary.planned_copies++;
+            plan_summary.copied_bytes += planned_entry.file_size_bytes;
+            copy_candidates.push_back(&planned_entry);
+        } else {
+            plan_summary.planned_renames++;
+            plan_summary.renamed_bytes += planned_entry.file_size_bytes;
+        }
+    }
+    
+    if (runtime_configuration.plan_bandwidth_megabytes_per_second > 0.0) {
+        plan_summary.copy_bandwidth_bytes_per_second = runtime_configuration.plan_bandwidth_megabytes_per_second * 1e6;
+    } else if (plan_summary.copied_bytes > 0) {
+        plan_summary.copy_bandwidth_bytes_per_second = measure_copy_read_bandwidth(copy_candidates);
+        plan_summary.bandwidth_measured = plan_summary.copy_bandwidth_bytes_per_second > 0.0;
+    }
+    plan_summary.estimated_seconds = plan_summary.planned_renames * PLAN_RENAME_COST_SECONDS;
+    if (plan_summary.copy_bandwidth_bytes_per_second > 0.0) {
+        plan_summary.estimated_seconds += plan_summary.copied_bytes / plan_summary.copy_bandwidth_bytes_per_second;
+    }
+    
+    // Save the plan for --replay-plan, or list it on the console
+    bool plan_saved = true;
+    if (!runtime_configuration.move_plan_file_path.empty()) {
+        // Paths are stored absolute so the plan can be replayed from any working directory
+        std::ofstream plan_stream(runtime_configuration.move_plan_file_path, std::ios::binary | std::ios::trunc);
+        std::error_code absolute_error;
+        plan_stream << MOVE_PLAN_MAGIC << "\n";
+        plan_stream << "destination\t" << escape_manifest_field(std::filesystem::absolute(
+            runtime_configuration.destination_directory_path, absolute_error).string()) << "\n";
+        std::string_view previous_directory_path;
+        std::string escaped_directory_path;
+        for (size_t entry_index = 0; entry_index < entry_count; ++entry_index) {
+            const file_classification_entry& planned_entry = entry_collection[entry_index];
+            if (entry_index == 0 || planned_entry.source_directory_path != previous_directory_path) {
+                previous_directory_path = planned_entry.source_directory_path;
+                escaped_directory_path = escape_manifest_field(std::filesystem::absolute(
+                    std::string(previous_directory_path), absolute_error).string());
+            }
+            plan_stream << "move\t" << (entry_requires_copy[entry_index] ? "copy" : "rename") << "\t"
+                        << CLASSIFICATION_CATEGORY_TABLE[planned_entry.category_identifier].directory_name << "\t"
+                        << planned_entry.file_size_bytes << "\t" << escaped_directory_path << "\t"
+                        << escape_manifest_field(planned_entry.filename_identifier) << "\n";
+        }
+        plan_stream.flush();
+        plan_saved = static_cast<bool>(plan_stream);
+        if (!plan_saved) std::cerr << "Cannot write move plan " << runtime_configuration.move_plan_file_path << "\n";
+    } else {
+        std::cout << "╔══════════════════════════════════════════════════════════════╗\n";
+        std::cout << "║                       PLANNED MOVES                          ║\n";
+        std::cout << "╠══════════════════════════════════════════════════════════════╣\n";
+        for (size_t entry_index = 0; entry_index < entry_count; ++entry_index) {
+            const file_classification_entry& planned_entry = entry_collection[entry_index];
+            std::cout << "║ " << (entry_requires_copy[entry_index] ? "Copy: " : "Move: ") << std::left << std::setw(25)
+                      << planned_entry.filename_identifier << " → "
+                      << std::setw(20) << CLASSIFICATION_CATEGORY_TABLE[planned_entry.category_identifier].directory_name
+                      << " [P" << static_cast<int>(planned_entry.processing_priority) << "] ║\n";
+        }
+        std::cout << "╚══════════════════════════════════════════════════════════════╝\n";
+    }
+    
+    if (runtime_configuration.quiet_mode_enabled) return plan_saved;  // Quiet runs only save the plan
+    
+    std::ostringstream bandwidth_text;
+    bandwidth_text << std::fixed << std::setprecision(1);
+    if (plan_summary.copy_bandwidth_bytes_per_second > 0.0) {
+        bandwidth_text << plan_summary.copy_bandwidth_bytes_per_second / 1e6 << " MB/s"
+                       << (plan_summary.bandwidth_measured ? " (measured read)" : " (--plan-bandwidth)");
+    } else {
+        bandwidth_text << (plan_summary.copied_bytes > 0 ? "unknown" : "not needed");
+    }
+    std::ostringstream estimate_text;
+    estimate_text << std::fixed << std::setprecision(1) << plan_summary.estimated_seconds << " s"
+                  << (plan_summary.copied_bytes > 0 && plan_summary.copy_bandwidth_bytes_per_second <= 0.0 ? " + copies" : "");
+    std::cout << "\nMove Plan: " << plan_summary.planned_renames << " same-device renames (" << plan_summary.renamed_bytes << " bytes), "
+              << plan_summary.planned_copies << " cross-device copies (" << plan_summary.copied_bytes << " bytes to copy)"
+              << (plan_summary.device_identity_known ? "" : ", devices not compared") << "\n";
+    std::cout << "Copy Bandwidth: " << bandwidth_text.str() << "; Estimated Duration: " << estimate_text.str() << "\n";
+    if (!runtime_configuration.move_plan_file_path.empty() && plan_saved) {
+        std::cout << "Plan saved to " << runtime_configuration.move_plan_file_path << " (run it with --replay-plan)\n";
+    }
+    return plan_saved;
+}
+
+// Moves loaded from a saved plan; entries borrow their strings from plan_storage
+struct loaded_move_plan {
+    std::string destination_root_path;        // Destination recorded when the plan was made
+    filename_storage_arena plan_storage;      // Directory and file names of the entries
+    std::vector<file_classification_entry> planned_entries;  // Moves in planned order
+};
+
+/**
+ * load_move_plan - Reads a plan written by execute_move_planning
+ */
+bool load_move_plan(const std::string& plan_file_path, loaded_move_plan& move_plan, std::string& error_message) {
+    std::ifstream plan_stream(plan_file_path, std::ios::binary);
+    std::string plan_line;
+    if (!plan_stream || !std::getline(plan_stream, plan_line) || plan_line != MOVE_PLAN_MAGIC) {
+        error_message = "not a move plan";
+        return false;
+    }
+    std::string_view previous_directory_path;
+    while (std::getline(plan_stream, plan_line)) {
+        std::vector<std::string> line_fields = split_manifest_line(plan_line);
+        if (line_fields[0] == "destination" && line_fields.size() == 2) {
+            move_plan.destination_root_path = line_fields[1];
+        } else if (line_fields[0] == "move" && line_fields.size() == 6) {
+            file_classification_entry planned_entry;
+            int category_index = 0;
+            while (category_index < CLASSIFICATION_CATEGORY_COUNT &&
+                   line_fields[2] != CLASSIFICATION_CATEGORY_TABLE[category_index].directory_name) {
+                category_index++;
+            }
+            if (category_index == CLASSIFICATION_CATEGORY_COUNT) {
+                error_message = "unknown category " + line_fields[2];
+                return false;
+            }
+            if (previous_directory_path != line_fields[4]) previous_directory_path = move_plan.plan_storage.store_c_string(line_fields[4]);
+            planned_entry.source_directory_path = previous_directory_path;
+            planned_entry.filename_identifier = move_plan.plan_storage.store_c_string(line_fields[5]);
+            planned_entry.file_size_bytes = std::strtoull(line_fields[3].c_str(), nullptr, 10);
+            planned_entry.category_identifier = static_cast<classification_category_identifier>(category_index);
+            planned_entry.processing_priority = calculate_processing_priority(planned_entry.category_identifier);
+            move_plan.planned_entries.push_back(planned_entry);
+        } else if (!plan_line.empty()) {
+            error_message = "unrecognized line: " + plan_line;
+            return false;
+        }
+    }
+    if (move_plan.destination_root_path.empty()) {
+        error_message = "missing destination line";
+        return false;
+    }
+    return true;
+}
+
+/**
+ * planned_entry_is_current - Whether a planned file still exists with its recorded size
+ * Sets stale_reason otherwise; symlinks are not followed, as during planning
+ */
+bool planned_entry_is_current(const file_classification_entry& planned_entry, const char*& stale_reason) {
+    std::string file_path(planned_entry.source_directory_path);
+    file_path += '/';
+    file_path += planned_entry.filename_identifier;
+#if defined(ARTLEST_POSIX_FILE_OPERATIONS)
+    struct stat file_status;
+    if (::lstat(file_path.c_str(), &file_status) != 0) {
+        stale_reason = std::strerror(errno);
+        return false;
+    }
+    uint64_t current_size = static_cast<uint64_t>(file_status.st_size);
+#else
+    std::error_code status_error;
+    uint64_t current_size = std::filesystem::file_size(file_path, status_error);
+    if (status_error) {
+        stale_reason = "no longer readable";
+        return false;
+    }
+#endif
+    if (current_size != planned_entry.file_size_bytes) {
+        stale_reason = "size changed since planning";
+        return false;
+    }
+    return true;
+}
+
+/**
+ * execute_move_plan_replay - Executes a saved plan without walking the source
+ * Every entry is checked against its recorded size first; files that changed
+ * or vanished since planning are left in place and reported as failed moves.
+ * Returns true when every planned file was moved
+ */
+bool execute_move_plan_replay(const execution_configuration_parameters& runtime_configuration, const loaded_move_plan& move_plan) {
+    bool report_output_enabled = !runtime_configuration.quiet_mode_enabled;
+    if (report_output_enabled) {
+        std::cout << "Replaying " << move_plan.planned_entries.size() << " planned moves into " << move_plan.destination_root_path << "\n";
+    }
+    auto replay_start = std::chrono::steady_clock::now();
+    classification_statistics_accumulator plan_statistics;  // Categories as recorded at planning time
+    std::vector<file_classification_entry> current_entries;
+    current_entries.reserve(move_plan.planned_entries.size());
+    size_t stale_entry_count = 0;
+    for (const file_classification_entry& planned_entry : move_plan.planned_entries) {
+        plan_statistics.record_classified_entry(planned_entry);
+        const char* stale_reason = nullptr;
+        if (planned_entry_is_current(planned_entry, stale_reason)) {
+            current_entries.push_back(planned_entry);
+        } else if (++stale_entry_count <= static_cast<size_t>(MAXIMUM_REPORTED_MOVE_ERRORS)) {
+            std::cerr << "\nMove failed: " << planned_entry.source_directory_path << "/" << planned_entry.filename_identifier
+                      << ": " << stale_reason << "\n";
+        }
+    }
+    file_move_executor move_executor;
+    if (!move_executor.prepare_destination_directories(move_plan.destination_root_path)) return false;
+    if (runtime_configuration.io_uring_backend_enabled) {
+        bool ring_enabled = move_executor.enable_io_uring_backend();
+        if (report_output_enabled) {
+            std::cout << (ring_enabled ? "Move Backend: io_uring batched renameat\n"
+                                       : "Move Backend: io_uring unavailable, using synchronous renameat\n");
+        }
+    }
+    if (runtime_configuration.adaptive_concurrency_enabled) move_executor.enable_adaptive_concurrency();
+    move_executor.execute_move_batch(current_entries.data(), current_entries.size());
+    file_move_statistics replay_statistics = move_executor.move_statistics();
+    replay_statistics.failed_moves += stale_entry_count;
+    if (report_output_enabled) {
+        display_move_statistics(replay_statistics);
+        display_move_concurrency(move_executor);
+    } else {
+        display_quiet_run_summary(plan_statistics, std::chrono::duration<double>(std::chrono::steady_clock::now() - replay_start).count(),
+                                  &replay_statistics);
+    }
+    return replay_statistics.failed_moves == 0;
+}
+
+/**
+ * execute_file_sorting_algorithm - Primary processing function implementation
+ * This function orchestrates the complete file sorting workflow including
+ * classification, priority assignment, and statistical analysis generation.
+ * A quiet run ends with its summary line unless the caller prints its own.
+ * Returns false when setup, an output file or any move failed
+ */
+bool execute_file_sorting_algorithm(const execution_configuration_parameters& runtime_configuration,
+                                    const rule_configuration_matcher& rule_matcher, bool quiet_summary_enabled = true) {
+    // Initialize core data structures for processing operations
+    const extension_classification_table& extension_classification_registry = BUILT_IN_EXTENSION_TABLE;
+    classification_result_store result_store;
+    std::vector<file_classification_entry> processed_file_results;  // Materialized only for random-access passes
+    std::vector<std::string> input_filename_collection;
+    bool report_output_enabled = !runtime_configuration.quiet_mode_enabled;  // Quiet runs skip every report, not just its output
+    
+    // Display processing initialization header
+    if (report_output_enabled) {
+        std::cout << "╔══════════════════════════════════════════════════════════════╗\n";
+        std::cout << "║              PROFESSIONAL FILE SORTING SYSTEM               ║\n";
+        std::cout << "║                   Processing Initialization                  ║\n";
+        std::cout << "╚══════════════════════════════════════════════════════════════╝\n\n";
+    }
+    
+    // Throughput mode times the classify stage and skips per-entry reporting
+    if (runtime_configuration.throughput_measurement_enabled) {
+        execute_throughput_measurement(runtime_configuration, extension_classification_registry);
+        return true;
+    }
+    
+    // One private state per classifier; the demonstration dataset is too small to split
+    bool demonstration_mode = runtime_configuration.source_directory_path.empty();
+    size_t classifier_thread_count = (demonstration_mode && !runtime_configuration.streaming_pipeline_enabled)
+                                         ? 1 : resolve_worker_thread_count(runtime_configuration.classifier_thread_count);
+    std::vector<classification_worker_state> worker_states(classifier_thread_count);
+    
+    // Create and open every destination directory once, before any file is touched
+    file_move_executor move_executor;
+    bool file_moves_enabled = !runtime_configuration.destination_directory_path.empty() &&
+                              !runtime_configuration.move_planning_enabled;
+    if (file_moves_enabled && !move_executor.prepare_destination_directories(runtime_configuration.destination_directory_path)) {
+        return false;
+    }
+    if (file_moves_enabled && runtime_configuration.adaptive_concurrency_enabled) move_executor.enable_adaptive_concurrency();
+    if (file_moves_enabled && runtime_configuration.io_uring_backend_enabled) {
+        bool ring_enabled = move_executor.enable_io_uring_backend();
+        if (report_output_enabled) {
+            std::cout << (ring_enabled ? "Move Backend: io_uring batched renameat\n\n"
+                                       : "Move Backend: io_uring unavailable, using synchronous renameat\n\n");
+        }
+    }
+    
+    // Live counters are sampled by the exporter thread; workers only publish into their own atomics
+    std::unique_ptr<live_statistics_exporter> statistics_exporter;
+    if (!runtime_configuration.statistics_file_path.empty()) {
+        statistics_exporter = std::make_unique<live_statistics_exporter>(runtime_configuration.statistics_file_path,
+                                                                         runtime_configuration.statistics_interval_seconds);
+        for (const classification_worker_state& worker_state : worker_states) {
+            statistics_exporter->attach_classification_counters(worker_state.published_statistics);
+        }
+        if (file_moves_enabled) statistics_exporter->attach_move_executor(move_executor);
+        statistics_exporter->start_exporting();
+    }
+    
+    // Incremental runs only see files that are new or changed since the saved index
+    std::unique_ptr<incremental_index_session> index_session = open_incremental_index_session(runtime_configuration);
+    
+    // Open TSV output before any work so an unwritable path fails fast
+    tsv_result_writer tsv_output;
+    std::string output_error_message;
+    if (runtime_configuration.output_format == RESULT_OUTPUT_TSV &&
+        !tsv_output.open_output(runtime_configuration.output_file_path, output_error_message)) {
+        std::cerr << "Cannot open result file " << runtime_configuration.output_file_path << ": " << output_error_message << "\n";
+        return false;
+    }
+    bool run_succeeded = true;  // Cleared by any later output or move failure
+    
+    // Streaming mode reports entries as they are classified and retains only counters
+    auto classification_start = std::chrono::steady_clock::now();
+    if (runtime_configuration.streaming_pipeline_enabled) {
+        run_succeeded = execute_streaming_classification_pipeline(
+            runtime_configuration, extension_classification_registry, worker_states, file_moves_enabled ? &move_executor : nullptr,
+            index_session.get(), runtime_configuration.output_format == RESULT_OUTPUT_TSV ? &tsv_output : nullptr, rule_matcher,
+            statistics_exporter.get());
+        if (!tsv_output.close_output(output_error_message)) {
+            std::cerr << "Result file " << runtime_configuration.output_file_path << " is incomplete: " << output_error_message << "\n";
+            run_succeeded = false;
+        }
+        double classification_elapsed_seconds =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - classification_start).count();
+        if (file_moves_enabled && report_output_enabled) {
+            display_move_statistics(move_executor.move_statistics());
+            display_move_concurrency(move_executor);
+        }
+        run_succeeded &= save_incremental_index_session(runtime_configuration, index_session.get());
+        classification_statistics_accumulator run_statistics =
+            perform_statistical_analysis(runtime_configuration, worker_states, classification_elapsed_seconds);
+        if (!runtime_configuration.shard_report_path.empty()) {
+            run_succeeded &= write_shard_report(runtime_configuration, run_statistics, classification_elapsed_seconds,
+                                                file_moves_enabled ? &move_executor.move_statistics() : nullptr);
+        }
+        if (runtime_configuration.quiet_mode_enabled && quiet_summary_enabled) {
+            display_quiet_run_summary(run_statistics, classification_elapsed_seconds,
+                                      file_moves_enabled ? &move_executor.move_statistics() : nullptr);
+        }
+        return run_succeeded && move_executor.move_statistics().failed_moves == 0;
+    }
+    
+    if (demonstration_mode) {
+        // Generate demonstration dataset for processing operations
+        prepare_input_dataset(runtime_configuration, input_filename_collection);
+        
+        // Execute primary processing loop; the reporter thread samples the counter
+        std::atomic<int> processing_iteration_counter(0);
+        int total_processing_iterations = input_filename_collection.size();
+        rate_limited_progress_reporter progress_reporter([&] {
+            display_progress_indicator(processing_iteration_counter.load(std::memory_order_relaxed), total_processing_iterations);
+        }, report_output_enabled);
+        
+        for (const std::string& current_filename : input_filename_collection) {
+            // Classify and store processed entry in results collection
+            processed_file_results.push_back(classify_filename_entry(current_filename, extension_classification_registry));
+            if (rule_matcher.has_rules()) apply_rule_configuration_to_entries(rule_matcher, "", &processed_file_results.back(), 1);
+            
+            // Publish the processing iteration counter for the reporter
+            processing_iteration_counter.store(processing_iteration_counter.load(std::memory_order_relaxed) + 1,
+                                               std::memory_order_relaxed);
+        }
+        progress_reporter.stop_reporting();
+        result_store.append_entries(processed_file_results.data(), processed_file_results.size());
+        processed_file_results.clear();
+    } else {
+        // Walk and classify in parallel, then concatenate the per-worker columns once
+        execute_parallel_collection_pass(runtime_configuration, extension_classification_registry, worker_states,
+                                         index_session.get(), rule_matcher, statistics_exporter.get());
+        for (classification_worker_state& worker_state : worker_states) {
+            result_store.append_store(std::move(worker_state.result_store));
+        }
+    }
+    
+    double classification_elapsed_seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - classification_start).count();
+    
+    // Complete progress indicator display
+    if (report_output_enabled) std::cout << "\n\nProcessing Operations Completed Successfully.\n\n";
+    
+    // Sort processed results by priority level for optimized organization
+    result_store.sort_by_processing_priority();
+    
+    // Duplicate flags, the move plan and the binary writer need every entry at once;
+    // everything else reads the store in chunks
+    bool random_access_required = runtime_configuration.duplicate_detection_enabled || runtime_configuration.move_planning_enabled ||
+                                  runtime_configuration.output_format == RESULT_OUTPUT_BINARY;
+    if (random_access_required) processed_file_results = result_store.materialize_entries();
+    auto for_each_result_chunk = [&](const classification_result_store::entry_chunk_consumer& chunk_consumer) {
+        if (random_access_required) {
+            chunk_consumer(processed_file_results.data(), processed_file_results.size());
+        } else {
+            result_store.for_each_entry_chunk(chunk_consumer);
+        }
+    };
+    
+    // Group identical files; the first copy in priority order is the one kept
+    duplicate_detection_summary detection_summary;
+    if (runtime_configuration.duplicate_detection_enabled) {
+        detection_summary = detect_duplicate_entries(processed_file_results,
+                                                     resolve_worker_thread_count(runtime_configuration.walker_thread_count));
+    }
+    
+    // Display detailed processing results, or write them for downstream tools
+    if (runtime_configuration.output_format == RESULT_OUTPUT_TABLE) {
+        if (report_output_enabled) {
+            std::cout << "╔══════════════════════════════════════════════════════════════╗\n";
+            std::cout << "║                    PROCESSING RESULTS                        ║\n";
+            std::cout << "╠══════════════════════════════════════════════════════════════╣\n";
+            
+            for_each_result_chunk(display_processing_results_table);
+            
+            std::cout << "╚══════════════════════════════════════════════════════════════╝\n";
+        }
+    } else {
+        bool output_written = true;
+        if (runtime_configuration.output_format == RESULT_OUTPUT_BINARY) {
+            output_written = write_binary_result_file(runtime_configuration.output_file_path, processed_file_results.data(),
+                                                      processed_file_results.size(), output_error_message);
+        } else {
+            for_each_result_chunk([&](const file_classification_entry* entry_collection, size_t entry_count) {
+                tsv_output.append_entries(entry_collection, entry_count);
+            });
+            output_written = tsv_output.close_output(output_error_message);
+        }
+        if (output_written) {
+            if (report_output_enabled) display_result_file_summary(runtime_configuration, result_store.size());
+        } else {
+            std::cerr << "Cannot write result file " << runtime_configuration.output_file_path << ": " << output_error_message << "\n";
+            run_succeeded = false;
+        }
+    }
+    
+    if (runtime_configuration.duplicate_detection_enabled && report_output_enabled) display_duplicate_detection_summary(detection_summary);
+    
+    // Move files in priority order; stable sorting keeps same-directory runs together
+    if (file_moves_enabled || runtime_configuration.move_planning_enabled) {
+        if (detection_summary.redundant_file_count > 0) {
+            // Redundant copies stay where they are
+            processed_file_results.erase(std::remove_if(processed_file_results.begin(), processed_file_results.end(),
+                                                        [](const file_classification_entry& processed_entry) {
+                                                            return processed_entry.redundant_duplicate;
+                                                        }),
+                                         processed_file_results.end());
+        }
+        if (runtime_configuration.move_planning_enabled) {
+            run_succeeded &= execute_move_planning(runtime_configuration, processed_file_results.data(), processed_file_results.size());
+        } else {
+            for_each_result_chunk([&](const file_classification_entry* entry_collection, size_t entry_count) {
+                move_executor.execute_move_batch(entry_collection, entry_count);
+            });
+            if (report_output_enabled) {
+                display_move_statistics(move_executor.move_statistics());
+                display_move_concurrency(move_executor);
+            }
+        }
+    }
+    run_succeeded &= save_incremental_index_session(runtime_configuration, index_session.get());
+    
+    // Execute comprehensive statistical analysis
+    classification_statistics_accumulator run_statistics =
+        perform_statistical_analysis(runtime_configuration, worker_states, classification_elapsed_seconds, &result_store);
+    if (!runtime_configuration.shard_report_path.empty()) {
+        run_succeeded &= write_shard_report(runtime_configuration, run_statistics, classification_elapsed_seconds,
+                                            file_moves_enabled ? &move_executor.move_statistics() : nullptr);
+    }
+    if (runtime_configuration.quiet_mode_enabled && quiet_summary_enabled) {
+        display_quiet_run_summary(run_statistics, classification_elapsed_seconds,
+                                  file_moves_enabled ? &move_executor.move_statistics() : nullptr);
+    }
+    return run_succeeded && move_executor.move_statistics().failed_moves == 0;
+}
+
+#if defined(__linux__)
+volatile sig_atomic_t watch_stop_requested = 0;  // Set by SIGINT/SIGTERM while --watch runs
+
+void request_watch_stop(int) { watch_stop_requested = 1; }
+
+/**
+ * watched_change_batch - Coalesced events of one --watch batch
+ * Files are keyed by directory so each directory is opened once per batch
+ */
+struct watched_change_batch {
+    std::unordered_map<std::string, std::unordered_set<std::string>> changed_files;  // Directory -> finished or moved-in names
+    std::vector<std::string> rescan_directories;  // New subtrees, listed (and watched) in full
+    size_t changed_file_count = 0;            // Distinct names across changed_files
+    bool queue_overflowed = false;            // The kernel dropped events, so the whole tree is rescanned
+    std::chrono::steady_clock::time_point first_event_timestamp;  // Arrival of the oldest event in the batch
+    
+    bool empty() const { return changed_file_count == 0 && rescan_directories.empty() && !queue_overflowed; }
+};
+
+/**
+ * source_change_watcher - inotify subscription covering every directory of the source tree
+ * Each directory is watched for files finished by close-write or moved in,
+ * and for subdirectories created or moved in; those are watched and listed
+ * in full, since files can land in them before their watch exists. The
+ * destination subtree is never watched, so moved files raise no events.
+ * When the kernel event queue overflows the affected directories are
+ * unknown and the whole tree is listed again
+ */
+class source_change_watcher {
+public:
+    source_change_watcher() = default;
+    ~source_change_watcher() {
+        if (notification_descriptor >= 0) close(notification_descriptor);
+    }
+
+    source_change_watcher(const source_change_watcher&) = delete;
+    source_change_watcher& operator=(const source_change_watcher&) = delete;
+
+    // Watch every directory under the source; false (with a reason) when the root cannot be watched
+    bool open_watcher(const std::string& source_root, const std::string& excluded_root, std::string& error_message) {
+        notification_descriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (notification_descriptor < 0) {
+            error_message = std::strerror(errno);
+            return false;
+        }
+        std::error_code canonical_error;
+        source_root_path = std::filesystem::weakly_canonical(source_root, canonical_error).string();
+        if (canonical_error) source_root_path = source_root;
+        if (!excluded_root.empty()) {
+            excluded_root_path = std::filesystem::weakly_canonical(excluded_root, canonical_error).string();
+            if (canonical_error) excluded_root_path = excluded_root;
+        }
+        watch_directory_subtree(source_root_path, nullptr);
+        if (watched_directory_paths.empty()) {
+            error_message = "no directory under " + source_root_path + " could be watched";
+            return false;
+        }
+        return true;
+    }
+
+    size_t watched_directory_count() const { return watched_directory_paths.size(); }
+    size_t failed_watch_count() const { return watch_failures; }
+    const std::string& watched_root_path() const { return source_root_path; }
+
+    /**
+     * wait_for_change_batch - Blocks until a burst of events has settled
+     * A batch closes once no event arrived for WATCH_COALESCE_MILLISECONDS,
+     * its oldest event is WATCH_MAXIMUM_BATCH_DELAY_MILLISECONDS old or it
+     * holds WATCH_MAXIMUM_BATCH_FILES files. New subtrees (and the whole tree
+     * after an overflow) are listed before returning. Returns false when a
+     * stop was requested while idle
+     */
+    bool wait_for_change_batch(watched_change_batch& change_batch) {
+        change_batch = watched_change_batch();
+        while (change_batch.empty()) {
+            if (watch_stop_requested) return false;
+            if (wait_for_events(WATCH_IDLE_POLL_MILLISECONDS)) drain_pending_events(change_batch);
+        }
+        auto batch_deadline = change_batch.first_event_timestamp + std::chrono::milliseconds(WATCH_MAXIMUM_BATCH_DELAY_MILLISECONDS);
+        while (!watch_stop_requested && !change_batch.queue_overflowed &&
+               change_batch.changed_file_count < WATCH_MAXIMUM_BATCH_FILES) {
+            auto remaining_delay = std::chrono::duration_cast<std::chrono::milliseconds>(batch_deadline - std::chrono::steady_clock::now());
+            if (remaining_delay.count() <= 0) break;
+            if (!wait_for_events(std::min<int>(WATCH_COALESCE_MILLISECONDS, static_cast<int>(remaining_delay.count())))) break;
+            drain_pending_events(change_batch);
+        }
+        
+        // Events still queued after an overflow describe files the rescan finds anyway
+        if (change_batch.queue_overflowed) change_batch.rescan_directories.assign(1, source_root_path);
+        std::vector<std::string> rescan_directories = change_batch.rescan_directories;
+        for (const std::string& rescan_directory : rescan_directories) watch_directory_subtree(rescan_directory, &change_batch);
+        return true;
+    }
+
+private:
+    static constexpr uint32_t WATCH_EVENT_MASK = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_ONLYDIR | IN_DONT_FOLLOW | IN_EXCL_UNLINK;
+
+    bool wait_for_events(int timeout_milliseconds) {
+        struct pollfd notification_poll = {notification_descriptor, POLLIN, 0};
+        return poll(&notification_poll, 1, timeout_milliseconds) > 0;  // EINTR on a stop signal
+    }
+
+    void drain_pending_events(watched_change_batch& change_batch) {
+        alignas(struct inotify_event) char event_buffer[WATCH_EVENT_BUFFER_SIZE];
+        for (;;) {
+            ssize_t bytes_read = read(notification_descriptor, event_buffer, sizeof(event_buffer));
+            if (bytes_read <= 0) return;  // EAGAIN: the queue is empty
+            for (char* event_cursor = event_buffer; event_cursor < event_buffer + bytes_read;) {
+                const struct inotify_event* change_event = reinterpret_cast<const struct inotify_event*>(event_cursor);
+                record_change_event(*change_event, change_batch);
+                event_cursor += sizeof(struct inotify_event) + change_event->len;
+            }
+        }
+    }
+
+    void record_change_event(const struct inotify_event& change_event, watched_change_batch& change_batch) {
+        if (change_event.mask & IN_Q_OVERFLOW) {
+            mark_batch_started(change_batch);
+            change_batch.queue_overflowed = true;
+            return;
+        }
+        auto watched_directory = watched_directory_paths.find(change_event.wd);
+        if (watched_directory == watched_directory_paths.end()) return;
+        if (change_event.mask & IN_IGNORED) {
+            watched_directory_paths.erase(watched_directory);  // Directory deleted or unmounted
+            return;
+        }
+        if (change_event.len == 0) return;
+        if (change_event.mask & IN_ISDIR) {
+            std::string subdirectory_path = watched_directory->second + "/" + change_event.name;
+            if ((change_event.mask & (IN_CREATE | IN_MOVED_TO)) && subdirectory_path != excluded_root_path) {
+                mark_batch_started(change_batch);
+                change_batch.rescan_directories.push_back(std::move(subdirectory_path));
+            }
+        } else if (change_event.mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) {
+            mark_batch_started(change_batch);
+            if (change_batch.changed_files[watched_directory->second].insert(change_event.name).second) {
+                change_batch.changed_file_count++;
+            }
+        }
+    }
+
+    static void mark_batch_started(watched_change_batch& change_batch) {
+        if (change_batch.empty()) change_batch.first_event_timestamp = std::chrono::steady_clock::now();
+    }
+
+    // Watch a subtree; with a batch, its regular files are added as changed too
+    void watch_directory_subtree(const std::string& subtree_root_path, watched_change_batch* change_batch) {
+        std::vector<std::string> pending_directories(1, subtree_root_path);
+        while (!pending_directories.empty()) {
+            std::string directory_path = std::move(pending_directories.back());
+            pending_directories.pop_back();
+            if (directory_path == excluded_root_path) continue;
+            
+            // Watching an inode again returns its existing descriptor, which then follows a renamed path
+            int watch_descriptor = inotify_add_watch(notification_descriptor, directory_path.c_str(), WATCH_EVENT_MASK);
+            if (watch_descriptor < 0) {
+                if (errno == ENOENT || errno == ENOTDIR) continue;  // Gone before it could be watched
+                if (watch_failures++ == 0) {
+                    std::cerr << "Cannot watch " << directory_path << ": " << std::strerror(errno)
+                              << (errno == ENOSPC ? " (raise fs.inotify.max_user_watches)" : "") << "\n";
+                }
+            } else {
+                watched_directory_paths[watch_descriptor] = directory_path;
+            }
+            
+            std::error_code enumeration_error;
+            std::filesystem::directory_iterator directory_cursor(
+                directory_path, std::filesystem::directory_options::skip_permission_denied, enumeration_error);
+            if (enumeration_error) continue;
+            for (const std::filesystem::directory_iterator directory_end; directory_cursor != directory_end;
+                 directory_cursor.increment(enumeration_error)) {
+                if (enumeration_error) break;
+                std::error_code status_error;
+                std::filesystem::file_status entry_status = directory_cursor->symlink_status(status_error);
+                if (status_error) continue;
+                if (std::filesystem::is_directory(entry_status)) {
+                    pending_directories.push_back(directory_cursor->path().string());
+                } else if (change_batch != nullptr && std::filesystem::is_regular_file(entry_status)) {
+                    mark_batch_started(*change_batch);
+                    if (change_batch->changed_files[directory_path].insert(directory_cursor->path().filename().string()).second) {
+                        change_batch->changed_file_count++;
+                    }
+                }
+            }
+        }
+    }
+
+    int notification_descriptor = -1;         // inotify instance
+    std::string source_root_path;             // Canonical root of the watched tree
+    std::string excluded_root_path;           // Canonical destination root, never watched
+    std::unordered_map<int, std::string> watched_directory_paths;  // Watch descriptor -> directory path
+    size_t watch_failures = 0;                // Directories that could not be watched
+};
+
+/**
+ * classify_watched_change_batch - Builds move entries for the files of one batch
+ * Names are checked with fstatat first: files already moved (e.g. by the initial
+ * run) or replaced by something other than a regular file are dropped silently
+ */
+void classify_watched_change_batch(const execution_configuration_parameters& runtime_configuration,
+                                   const extension_classification_table& mapping_registry,
+                                   const rule_configuration_matcher& rule_matcher,
+                                   const watched_change_batch& change_batch, filename_storage_arena& batch_storage,
+                                   std::vector<file_classification_entry>& batch_entries,
+                                   classification_statistics_accumulator& watch_statistics) {
+    for (const auto& [directory_path, changed_names] : change_batch.changed_files) {
+        int directory_descriptor = open(directory_path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (directory_descriptor < 0) continue;  // The directory went away with its files
+        std::string_view stored_directory_path = batch_storage.store_c_string(directory_path);
+        size_t directory_start = batch_entries.size();
+        for (const std::string& changed_name : changed_names) {
+            struct stat file_status;
+            if (fstatat(directory_descriptor, changed_name.c_str(), &file_status, AT_SYMLINK_NOFOLLOW) != 0 ||
+                !S_ISREG(file_status.st_mode)) {
+                continue;
+            }
+            file_classification_entry changed_entry =
+                classify_filename_entry(batch_storage.store_c_string(changed_name), mapping_registry);
+            changed_entry.source_directory_path = stored_directory_path;
+            changed_entry.file_size_bytes = static_cast<uint64_t>(file_status.st_size);
+            batch_entries.push_back(changed_entry);
+        }
+        close(directory_descriptor);
+        
+        size_t directory_entry_count = batch_entries.size() - directory_start;
+        if (directory_entry_count == 0) continue;
+        if (rule_matcher.has_rules()) {
+            apply_rule_configuration_to_entries(rule_matcher, stored_directory_path, batch_entries.data() + directory_start,
+                                                directory_entry_count);
+        }
+        if (runtime_configuration.content_sniffing_enabled) {
+            sniff_unclassified_directory_entries(stored_directory_path, batch_entries.data() + directory_start,
+                                                 directory_entry_count, watch_statistics);
+        }
+    }
+    for (const file_classification_entry& batch_entry : batch_entries) watch_statistics.record_classified_entry(batch_entry);
+    sort_entries_by_processing_priority(batch_entries);
+}
+#endif
+
+/**
+ * execute_watch_daemon - Sorts files as they arrive until SIGINT or SIGTERM
+ * Watches are registered before an initial full run, so files landing during
+ * that run are not missed (at worst a file is seen twice and its second
+ * sighting finds it already moved). Afterwards each coalesced event batch
+ * takes the classify, priority and move path of a normal run, and the
+ * process sleeps in poll while the tree is idle. Returns false when watching
+ * could not start or any move of the initial run or a batch failed
+ */
+bool execute_watch_daemon(const execution_configuration_parameters& runtime_configuration,
+                          const rule_configuration_matcher& rule_matcher) {
+#if defined(__linux__)
+    source_change_watcher change_watcher;
+    std::string error_message;
+    if (!change_watcher.open_watcher(runtime_configuration.source_directory_path,
+                                     runtime_configuration.destination_directory_path, error_message)) {
+        std::cerr << "Cannot watch source tree: " << error_message << "\n";
+        return false;
+    }
+    // The daemon prints the one quiet summary line at shutdown, so the initial run leaves none
+    bool initial_run_succeeded = execute_file_sorting_algorithm(runtime_configuration, rule_matcher, false);
+    
+    file_move_executor move_executor;
+    if (!move_executor.prepare_destination_directories(runtime_configuration.destination_directory_path)) return false;
+    if (runtime_configuration.adaptive_concurrency_enabled) move_executor.enable_adaptive_concurrency();
+    if (runtime_configuration.io_uring_backend_enabled) move_executor.enable_io_uring_backend();
+    
+    struct sigaction stop_action = {};
+    stop_action.sa_handler = request_watch_stop;
+    sigemptyset(&stop_action.sa_mask);
+    sigaction(SIGINT, &stop_action, nullptr);   // No SA_RESTART: poll returns at once
+    sigaction(SIGTERM, &stop_action, nullptr);
+    
+    bool report_output_enabled = !runtime_configuration.quiet_mode_enabled;
+    if (report_output_enabled) {
+        std::cout << "\n╔══════════════════════════════════════════════════════════════╗\n";
+        std::cout << "║                        WATCH MODE                            ║\n";
+        std::cout << "╚══════════════════════════════════════════════════════════════╝\n";
+        std::cout << "Watching " << change_watcher.watched_directory_count() << " directories under "
+                  << change_watcher.watched_root_path() << " (SIGINT or SIGTERM stops)\n";
+        if (change_watcher.failed_watch_count() > 0) {
+            std::cout << "Unwatched Directories: " << change_watcher.failed_watch_count() << "\n";
+        }
+        std::cout.flush();
+    }
+    
+    // Counters restart here; the initial run has already written its final totals
+    published_classification_counters published_watch_statistics;
+    std::unique_ptr<live_statistics_exporter> statistics_exporter;
+    if (!runtime_configuration.statistics_file_path.empty()) {
+        statistics_exporter = std::make_unique<live_statistics_exporter>(runtime_configuration.statistics_file_path,
+                                                                         runtime_configuration.statistics_interval_seconds);
+        statistics_exporter->attach_classification_counters(published_watch_statistics);
+        statistics_exporter->attach_move_executor(move_executor);
+        statistics_exporter->start_exporting();
+    }
+    
+    auto watch_start = std::chrono::steady_clock::now();
+    classification_statistics_accumulator watch_statistics;
+    size_t processed_batch_count = 0;
+    watched_change_batch change_batch;
+    filename_storage_arena batch_storage;
+    std::vector<file_classification_entry> batch_entries;
+    while (change_watcher.wait_for_change_batch(change_batch)) {
+        batch_storage = filename_storage_arena();
+        batch_entries.clear();
+        classify_watched_change_batch(runtime_configuration, BUILT_IN_EXTENSION_TABLE, rule_matcher, change_batch,
+                                      batch_storage, batch_entries, watch_statistics);
+        file_move_statistics statistics_before = move_executor.move_statistics();
+        move_executor.execute_move_batch(batch_entries.data(), batch_entries.size());
+        published_watch_statistics.publish_statistics(watch_statistics);
+        const file_move_statistics& statistics_after = move_executor.move_statistics();
+        if (batch_entries.empty() && !change_batch.queue_overflowed) continue;  // Every file had already gone
+        processed_batch_count++;
+        if (!report_output_enabled) continue;
+        
+        double batch_latency_milliseconds =
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - change_batch.first_event_timestamp).count();
+        std::cout << "Watch Batch " << processed_batch_count << ": " << batch_entries.size() << " files from "
+                  << change_batch.changed_files.size() << " directories | Moved: "
+                  << (statistics_after.files_renamed + statistics_after.files_copied) -
+                     (statistics_before.files_renamed + statistics_before.files_copied)
+                  << " | Failed: " << statistics_after.failed_moves - statistics_before.failed_moves
+                  << " | Latency: " << std::fixed << std::setprecision(1) << batch_latency_milliseconds << " ms"
+                  << (change_batch.queue_overflowed ? " | Event queue overflow: tree rescanned" : "") << "\n";
+        std::cout.flush();
+    }
+    
+    double watch_elapsed_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - watch_start).count();
+    if (report_output_enabled) {
+        std::cout << "\nWatch Stopped: " << processed_batch_count << " batches, " << watch_statistics.total_files_processed
+                  << " files classified in " << std::fixed << std::setprecision(1) << watch_elapsed_seconds << " s\n";
+        display_move_statistics(move_executor.move_statistics());
+        display_move_concurrency(move_executor);
+    } else {
+        display_quiet_run_summary(watch_statistics, watch_elapsed_seconds, &move_executor.move_statistics());
+    }
+    return initial_run_succeeded && move_executor.move_statistics().failed_moves == 0;
+#else
+    (void)rule_matcher;
+    std::cerr << "--watch is only supported on Linux (inotify); " << runtime_configuration.source_directory_path
+              << " was not watched\n";
+    return false;
+#endif
+}
+
+#if defined(ARTLEST_ENABLE_INSTRUMENTATION)
+/**
+ * write_instrumentation_report - Sums every thread's counters and renders them
+ * Safe to call while workers run; concurrent updates may land in the next report
+ */
+void write_instrumentation_report(std::ostream& report_stream) {
+    uint64_t stage_ticks[INSTRUMENTATION_STAGE_COUNT] = {};
+    uint64_t stage_invocations[INSTRUMENTATION_STAGE_COUNT] = {};
+    uint64_t lookup_hits[CLASSIFICATION_CATEGORY_COUNT] = {};
+    uint64_t lookup_misses = 0;
+    int reporting_thread_count = 0;
+    for (thread_instrumentation_counters* thread_counters = instrumentation_registry_head.load(std::memory_order_acquire);
+         thread_counters != nullptr; thread_counters = thread_counters->next_registered) {
+        for (int stage_index = 0; stage_index < INSTRUMENTATION_STAGE_COUNT; ++stage_index) {
+            stage_ticks[stage_index] += thread_counters->stage_ticks[stage_index].load(std::memory_order_relaxed);
+            stage_invocations[stage_index] += thread_counters->stage_invocations[stage_index].load(std::memory_order_relaxed);
+        }
+        for (int category_index = 0; category_index < CLASSIFICATION_CATEGORY_COUNT; ++category_index) {
+            lookup_hits[category_index] += thread_counters->lookup_hits[category_index].load(std::memory_order_relaxed);
+        }
+        lookup_misses += thread_counters->lookup_misses.load(std::memory_order_relaxed);
+        reporting_thread_count++;
+    }
+    
+    // Calibrate ticks against steady_clock over the whole run
+    double elapsed_nanoseconds = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - INSTRUMENTATION_CLOCK_ORIGIN.second).count());
+    double elapsed_ticks = static_cast<double>(read_instrumentation_ticks() - INSTRUMENTATION_CLOCK_ORIGIN.first);
+    double nanoseconds_per_tick = elapsed_ticks > 0 ? elapsed_nanoseconds / elapsed_ticks : 1.0;
+    
+    std::ostringstream report_text;
+    report_text << std::fixed;
+    report_text << "╔══════════════════════════════════════════════════════════════╗\n";
+    report_text << "║                  INSTRUMENTATION REPORT                      ║\n";
+    report_text << "╠══════════════════════════════════════════════════════════════╣\n";
+    report_text << "║ " << std::left << std::setw(22) << "Stage (all threads)" << std::right << std::setw(12) << "Calls"
+                << std::setw(14) << "Total ms" << std::setw(12) << "ns/call" << " ║\n";
+    for (int stage_index = 0; stage_index < INSTRUMENTATION_STAGE_COUNT; ++stage_index) {
+        if (stage_invocations[stage_index] == 0) continue;
+        double stage_nanoseconds = stage_ticks[stage_index] * nanoseconds_per_tick;
+        report_text << "║ " << std::left << std::setw(22) << INSTRUMENTATION_STAGE_NAMES[stage_index] << std::right
+                    << std::setw(12) << stage_invocations[stage_index]
+                    << std::setw(14) << std::setprecision(3) << stage_nanoseconds / 1e6
+                    << std::setw(12) << std::setprecision(1) << stage_nanoseconds / stage_invocations[stage_index] << " ║\n";
+    }
+    report_text << "╠══════════════════════════════════════════════════════════════╣\n";
+    for (int category_index = 0; category_index < CLASSIFICATION_CATEGORY_COUNT; ++category_index) {
+        if (lookup_hits[category_index] == 0) continue;
+        report_text << "║ Lookup Hits " << std::left << std::setw(25) << CLASSIFICATION_CATEGORY_TABLE[category_index].directory_name
+                    << std::right << std::setw(23) << lookup_hits[category_index] << " ║\n";
+    }
+    report_text << "║ Lookup Misses" << std::setw(47) << lookup_misses << " ║\n";
+    std::string allocation_summary = std::to_string(instrumented_allocation_count.load(std::memory_order_relaxed)) + " (" +
+                                     std::to_string(instrumented_allocation_bytes.load(std::memory_order_relaxed)) + " bytes)";
+    report_text << "║ Allocations" << std::setw(49) << allocation_summary << " ║\n";
+    report_text << "║ Reporting Threads" << std::setw(43) << reporting_thread_count << " ║\n";
+    report_text << "╚══════════════════════════════════════════════════════════════╝\n";
+    report_stream << report_text.str();
+    report_stream.flush();
+}
+
+/**
+ * start_instrumentation_signal_listener - Dumps the report to stderr on SIGUSR1
+ * Must run before any other thread starts: SIGUSR1 is blocked here and the
+ * mask is inherited, so only the listener's sigwait ever receives it and the
+ * report is produced outside signal-handler context
+ */
+void start_instrumentation_signal_listener() {
+#if defined(ARTLEST_POSIX_FILE_OPERATIONS)
+    sigset_t report_signal_set;
+    sigemptyset(&report_signal_set);
+    sigaddset(&report_signal_set, SIGUSR1);
+    if (pthread_sigmask(SIG_BLOCK, &report_signal_set, nullptr) != 0) return;
+    std::thread([report_signal_set] {
+        int received_signal = 0;
+        while (sigwait(&report_signal_set, &received_signal) == 0) write_instrumentation_report(std::cerr);
+    }).detach();
+#endif
+}
+
+// Writes the final report when main returns
+struct instrumentation_exit_report {
+    ~instrumentation_exit_report() { write_instrumentation_report(std::cerr); }
+};
+#endif
+
+/**
+ * display_usage_information - Prints supported command line options
+ * This function documents the runtime switches accepted by the sorter
+ */
+void display_usage_information(const char* program_name) {
+    std::cout << "Usage: " << program_name << " [options]\n"
+              << "  --source <directory>   Classify files found under directory (default: demo dataset)\n"
+              << "  --destination <dir>    Move classified files into <dir>/<CATEGORY>/\n"
+              << "  --threads <count>      Directory walker threads (default: hardware concurrency)\n"
+              << "  --throughput           Measure classify stage files/sec and ns/file\n"
+              << "  --repeat <count>       Passes in throughput mode / repetitions in bench mode\n"
+              << "  --stream               Report entries as they are classified (bounded memory)\n"
+              << "  --classifiers <count>  Classifier threads (default: hardware concurrency)\n"
+              << "  --stat                 Collect size, inode and mtime for every file\n"
+              << "  --io-uring             Batch stat and rename calls through io_uring (Linux)\n"
+              << "  --index <file>         Persistent index; re-runs skip unchanged directories and files\n"
+              << "  --rules <file>         Load extension/glob/size/prefix rules that override the built-in table\n"
+              << "  --sniff                Classify unknown extensions by their first bytes\n"
+              << "  --plan                 Dry run: list the moves --destination would make with a cost estimate\n"
+              << "  --plan-file <file>     Save the plan to <file> instead of listing it\n"
+              << "  --plan-bandwidth <MB/s> Copy rate for the estimate instead of measuring source reads\n"
+              << "  --replay-plan <file>   Execute a saved plan without walking the source again\n"
+              << "  --adaptive-io          Tune walker and per-device move concurrency from observed latency\n"
+              << "  --memory-limit <MB>    Stream into an external sort (priority, then path) that stays under <MB>\n"
+              << "  --sort-by-size         External sort puts larger files first within each priority level\n"
+              << "  --sort-temp-dir <dir>  Directory for external sort run files (default: system temp)\n"
+              << "  --dedupe               Find duplicate files (size, head/tail hash, full hash); skip moving copies\n"
+              << "  --output-format <fmt>  Per-entry results as table (default), binary or tsv\n"
+              << "  --output-file <file>   Result file for binary and tsv output\n"
+              << "  --generate <count>     Classify <count> generated names instead of the demo list\n"
+              << "  --zipf <exponent>      Extension popularity skew of generated names (default: 1.0)\n"
+              << "  --miss-rate <fraction> Generated names without a known extension (default: 0.05)\n"
+              << "  --seed <value>         Generator seed for reproducible datasets (default: 13)\n"
+              << "  --generate-tree <dir>  Write generated names as empty files under <dir> and exit\n"
+              << "  --tree-depth <levels>  Directory levels of the generated tree (default: 2)\n"
+              << "  --tree-fanout <count>  Subdirectories per generated directory (default: 8)\n"
+              << "  --split-shards <count> Split --source into shard manifests (needs --shard-prefix) and exit\n"
+              << "  --shard-prefix <path>  Manifests are written as <path>-<N>.manifest\n"
+              << "  --shard <manifest>     Process only the subtrees of one shard manifest\n"
+              << "  --shard-report <file>  Save this run's histograms for --merge-reports\n"
+              << "  --merge-reports <files...>  Combine shard reports into one global report\n"
+              << "  --watch                Keep running: sort files as they arrive under --source (Linux inotify)\n"
+              << "  --stats-file <file>    Rewrite live counters to <file> (Prometheus text format) during the run\n"
+              << "  --stats-interval <s>   Seconds between statistics file rewrites (default: 5)\n"
+              << "  --quiet                No banners, progress or reports; print one summary line (cron runs)\n"
+              << "  --bench                Run stage micro benchmarks and a walk macro benchmark; print JSON\n"
+              << "  --bench-names <count>  Synthetic names for micro benchmarks (default: 1000000)\n"
+              << "  --self-test            Check the content hash against the XXH64 reference vectors and exit\n"
+              << "  --help                 Display this usage information\n";
+}
+
+/**
+ * parse_command_line_arguments - Translates argv into runtime configuration
+ * This function validates option values and reports malformed input so that
+ * main can terminate before any processing begins
+ */
+bool parse_command_line_arguments(int argument_count, char* argument_values[],
+                                  execution_configuration_parameters& runtime_configuration) {
+    for (int argument_index = 1; argument_index < argument_count; ++argument_index) {
+        std::string current_argument = argument_values[argument_index];
+        bool has_option_value = argument_index + 1 < argument_count;
+        
+        if (current_argument == "--help") {
+            runtime_configuration.usage_requested = true;
+            return true;
+        } else if (current_argument == "--source" && has_option_value) {
+            runtime_configuration.source_directory_path = argument_values[++argument_index];
+        } else if (current_argument == "--throughput") {
+            runtime_configuration.throughput_measurement_enabled = true;
+        } else if (current_argument == "--repeat" && has_option_value) {
+            runtime_configuration.throughput_repeat_count = std::atoi(argument_values[++argument_index]);
+            if (runtime_configuration.throughput_repeat_count <= 0) {
+                std::cerr << "Invalid repeat count: " << argument_values[argument_index] << "\n";
+                return false;
+            }
+        } else if (current_argument == "--output-format" && has_option_value) {
+            std::string format_name = argument_values[++argument_index];
+            if (format_name == "table") {
+                runtime_configuration.output_format = RESULT_OUTPUT_TABLE;
+            } else if (format_name == "binary") {
+                runtime_configuration.output_format = RESULT_OUTPUT_BINARY;
+            } else if (format_name == "tsv") {
+                runtime_configuration.output_format = RESULT_OUTPUT_TSV;
+            } else {
+                std::cerr << "Invalid output format: " << format_name << "\n";
+                return false;
+            }
+        } else if (current_argument == "--rules" && has_option_value) {
+            runtime_configuration.rule_file_path = argument_values[++argument_index];
+        } else if (current_argument == "--bench") {
+            runtime_configuration.benchmark_mode_enabled = true;
+        } else if (current_argument == "--self-test") {
+            runtime_configuration.self_test_requested = true;
+        } else if (current_argument == "--bench-names" && has_option_value) {
+            long long requested_name_count = std::atoll(argument_values[++argument_index]);
+            if (requested_name_count <= 0) {
+                std::cerr << "Invalid benchmark name count: " << argument_values[argument_index] << "\n";
+                return false;
+            }
+            runtime_configuration.benchmark_name_count = static_cast<size_t>(requested_name_count);
+        } else if (current_argument == "--generate" && has_option_value) {
+            long long requested_name_count = std::atoll(argument_values[++argument_index]);
+            if (requested_name_count <= 0) {
+                std::cerr << "Invalid generated name count: " << argument_values[argument_index] << "\n";
+                return false;
+            }
+            runtime_configuration.synthetic_name_count = static_cast<size_t>(requested_name_count);
+        } else if (current_argument == "--zipf" && has_option_value) {
+            runtime_configuration.synthetic_zipf_exponent = std::atof(argument_values[++argument_index]);
+            if (runtime_configuration.synthetic_zipf_exponent < 0.0) {
+                std::cerr << "Invalid Zipf exponent: " << argument_values[argument_index] << "\n";
+                return false;
+            }
+        } else if (current_argument == "--miss-rate" && has_option_value) {
+            runtime_configuration.synthetic_miss_rate = std::atof(argument_values[++argument_index]);
+            if (runtime_configuration.synthetic_miss_rate < 0.0 || runtime_configuration.synthetic_miss_rate > 1.0) {
+                std::cerr << "Invalid miss rate: " << argument_values[argument_index] << "\n";
+                return false;
+            }
+        } else if (current_argument == "--seed" && has_option_value) {
+            runtime_configuration.synthetic_seed = std::strtoull(argument_values[++argument_index], nullptr, 10);
+        } else if (current_argument == "--generate-tree" && has_option_value) {
+            runtime_configuration.synthetic_tree_path = argument_values[++argument_index];
+        } else if (current_argument == "--tree-depth" && has_option_value) {
+            runtime_configuration.synthetic_tree_depth = std::atoi(argument_values[++argument_index]);
+            if (runtime_configuration.synthetic_tree_depth < 0 || runtime_configuration.synthetic_tree_depth > 16) {
+                std::cerr << "Invalid tree depth: " << argument_values[argument_index] << "\n";
+                return false;
+            }
+        } else if (current_argument == "--tree-fanout" && has_option_value) {
+            runtime_configuration.synthetic_tree_fanout = std::atoi(argument_values[++argument_index]);
+            if (runtime_configuration.synthetic_tree_fanout <= 0) {
+                std::cerr << "Invalid tree fanout: " << argument_values[argument_index] << "\n";
+                return false;
+            }
+        } else if (current_argument == "--split-shards" && has_option_value) {
+            runtime_configuration.shard_split_count = std::atoi(argument_values[++argument_index]);
+            if (runtime_configuration.shard_split_count <= 0) {
+                std::cerr << "Invalid shard count: " << argument_values[argument_index] << "\n";
+                return false;
+            }
+        } else if (current_argument == "--shard-prefix" && has_option_value) {
+            runtime_configuration.shard_manifest_prefix = argument_values[++argument_index];
+        } else if (current_argument == "--shard" && has_option_value) {
+            runtime_configuration.shard_manifest_path = argument_values[++argument_index];
+        } else if (current_argument == "--shard-report" && has_option_value) {
+            runtime_configuration.shard_report_path = argument_values[++argument_index];
+        } else if (current_argument == "--merge-reports" && has_option_value) {
+            size_t collected_report_count = runtime_configuration.merge_report_paths.size();
+            while (argument_index + 1 < argument_count && std::strncmp(argument_values[argument_index + 1], "--", 2) != 0) {
+                runtime_configuration.merge_report_paths.push_back(argument_values[++argument_index]);
+            }
+            if (runtime_configuration.merge_report_paths.size() == collected_report_count) {
+                std::cerr << "--merge-reports requires at least one report file\n";
+                return false;
+            }
+        } else if (current_argument == "--plan") {
+            runtime_configuration.move_planning_enabled = true;
+        } else if (current_argument == "--plan-file" && has_option_value) {
+            runtime_configuration.move_plan_file_path = argument_values[++argument_index];
+        } else if (current_argument == "--plan-bandwidth" && has_option_value) {
+            runtime_configuration.plan_bandwidth_megabytes_per_second = std::atof(argument_values[++argument_index]);
+            if (runtime_configuration.plan_bandwidth_megabytes_per_second <= 0.0) {
+                std::cerr << "Invalid plan bandwidth: " << argument_values[argument_index] << "\n";
+                return false;
+            }
+        } else if (current_argument == "--replay-plan" && has_option_value) {
+            runtime_configuration.replay_plan_path = argument_values[++argument_index];
+        } else if (current_argument == "--adaptive-io") {
+            runtime_configuration.adaptive_concurrency_enabled = true;
+        } else if (current_argument == "--memory-limit" && has_option_value) {
+            long long memory_limit_megabytes = std::atoll(argument_values[++argument_index]);
+            if (memory_limit_megabytes < static_cast<long long>(EXTERNAL_SORT_MINIMUM_MEMORY_MB)) {
+                std::cerr << "Invalid memory limit (minimum " << EXTERNAL_SORT_MINIMUM_MEMORY_MB << " MB): " << argument_values[argument_index] << "\n";
+                return false;
+            }
+            runtime_configuration.sort_memory_limit_bytes = static_cast<size_t>(memory_limit_megabytes) << 20;
+        } else if (current_argument == "--sort-by-size") {
+            runtime_configuration.sort_by_size_enabled = true;
+        } else if (current_argument == "--sort-temp-dir" && has_option_value) {
+            runtime_configuration.sort_temporary_directory = argument_values[++argument_index];
+        } else if (current_argument == "--dedupe") {
+            runtime_configuration.duplicate_detection_enabled = true;
+        } else if (current_argument == "--sniff") {
+            runtime_configuration.content_sniffing_enabled = true;
+        } else if (current_argument == "--output-file" && has_option_value) {
+            runtime_configuration.output_file_path = argument_values[++argument_index];
+        } else if (current_argument == "--index" && has_option_value) {
+            runtime_configuration.incremental_index_path = argument_values[++argument_index];
+        } else if (current_argument == "--stat") {
+            runtime_configuration.metadata_collection_enabled = true;
+        } else if (current_argument == "--io-uring") {
+            runtime_configuration.io_uring_backend_enabled = true;
+        } else if (current_argument == "--stats-file" && has_option_value) {
+            runtime_configuration.statistics_file_path = argument_values[++argument_index];
+        } else if (current_argument == "--stats-interval" && has_option_value) {
+            runtime_configuration.statistics_interval_seconds = std::atof(argument_values[++argument_index]);
+            if (runtime_configuration.statistics_interval_seconds < 0.1) {
+                std::cerr << "Invalid statistics interval (at least 0.1 seconds): " << argument_values[argument_index] << "\n";
+                return false;
+            }
+        } else if (current_argument == "--watch") {
+            runtime_configuration.watch_mode_enabled = true;
+        } else if (current_argument == "--quiet") {
+            runtime_configuration.quiet_mode_enabled = true;
+        } else if (current_argument == "--stream") {
+            runtime_configuration.streaming_pipeline_enabled = true;
+        } else if (current_argument == "--classifiers" && has_option_value) {
+            runtime_configuration.classifier_thread_count = std::atoi(argument_values[++argument_index]);
+            if (runtime_configuration.classifier_thread_count <= 0) {
+                std::cerr << "Invalid classifier count: " << argument_values[argument_index] << "\n";
+                return false;
+            }
+        } else if (current_argument == "--destination" && has_option_value) {
+            runtime_configuration.destination_directory_path = argument_values[++argument_index];
+        } else if (current_argument == "--threads" && has_option_value) {
+            runtime_configuration.walker_thread_count = std::atoi(argument_values[++argument_index]);
+            if (runtime_configuration.walker_thread_count <= 0) {
+                std::cerr << "Invalid thread count: " << argument_values[argument_index] << "\n";
+                return false;
+            }
+        } else {
+            std::cerr << "Unrecognized or incomplete option: " << current_argument << "\n";
+            return false;
+        }
+    }
+    
+    // A shard manifest supplies the source root and the subtrees to walk
+    if (!runtime_configuration.shard_manifest_path.empty()) {
+        if (!runtime_configuration.source_directory_path.empty() || runtime_configuration.shard_split_count > 0) {
+            std::cerr << "--shard cannot be combined with --source or --split-shards\n";
+            return false;
+        }
+        std::string manifest_error;
+        if (!load_shard_manifest(runtime_configuration, manifest_error)) {
+            std::cerr << "Invalid shard manifest " << runtime_configuration.shard_manifest_path << ": " << manifest_error << "\n";
+            return false;
+        }
+    }
+    if (runtime_configuration.shard_split_count > 0 &&
+        (runtime_configuration.source_directory_path.empty() || runtime_configuration.shard_manifest_prefix.empty())) {
+        std::cerr << "--split-shards requires --source and --shard-prefix\n";
+        return false;
+    }
+    if (!runtime_configuration.shard_report_path.empty() &&
+        (runtime_configuration.source_directory_path.empty() || runtime_configuration.throughput_measurement_enabled)) {
+        std::cerr << "--shard-report requires --source or --shard and cannot be combined with --throughput\n";
+        return false;
+    }
+    
+    // Moving requires real input and is meaningless while only timing classification
+    if (!runtime_configuration.destination_directory_path.empty() &&
+        (runtime_configuration.source_directory_path.empty() || runtime_configuration.throughput_measurement_enabled)) {
+        std::cerr << "--destination requires --source and cannot be combined with --throughput\n";
+        return false;
+    }
+    
+    // Planning needs the full sorted entry list and the destination it would move into
+    if (runtime_configuration.move_planning_enabled) {
+        if (runtime_configuration.destination_directory_path.empty() || runtime_configuration.streaming_pipeline_enabled ||
+            !runtime_configuration.incremental_index_path.empty()) {
+            std::cerr << "--plan requires --source and --destination and cannot be combined with --stream or --index\n";
+            return false;
+        }
+        runtime_configuration.metadata_collection_enabled = true;
+    } else if (!runtime_configuration.move_plan_file_path.empty() || runtime_configuration.plan_bandwidth_megabytes_per_second > 0.0) {
+        std::cerr << "--plan-file and --plan-bandwidth require --plan\n";
+        return false;
+    }
+    if (!runtime_configuration.replay_plan_path.empty() &&
+        (!runtime_configuration.source_directory_path.empty() || !runtime_configuration.destination_directory_path.empty())) {
+        std::cerr << "--replay-plan cannot be combined with --source or --destination (the plan records both)\n";
+        return false;
+    }
+    
+    // Adaptive limits govern real I/O only
+    if (runtime_configuration.adaptive_concurrency_enabled && runtime_configuration.source_directory_path.empty() &&
+        runtime_configuration.replay_plan_path.empty()) {
+        std::cerr << "--adaptive-io requires --source or --replay-plan\n";
+        return false;
+    }
+    
+    // Benchmarks never touch files beyond reading the macro tree
+    if (runtime_configuration.benchmark_mode_enabled &&
+        (!runtime_configuration.destination_directory_path.empty() || runtime_configuration.throughput_measurement_enabled)) {
+        std::cerr << "--bench cannot be combined with --destination or --throughput\n";
+        return false;
+    }
+    
+    // Generated names replace the demo list, so they cannot be mixed with a real tree
+    if (runtime_configuration.synthetic_name_count > 0 && !runtime_configuration.source_directory_path.empty() &&
+        runtime_configuration.synthetic_tree_path.empty()) {
+        std::cerr << "--generate cannot be combined with --source (use --generate-tree, then --source)\n";
+        return false;
+    }
+    if (!runtime_configuration.synthetic_tree_path.empty()) {
+        if (runtime_configuration.synthetic_name_count == 0) runtime_configuration.synthetic_name_count = SYNTHETIC_DEFAULT_TREE_FILE_COUNT;
+        size_t total_directory_count = 0;
+        for (size_t level_width = 1, level_index = 0; level_index <= static_cast<size_t>(runtime_configuration.synthetic_tree_depth); ++level_index) {
+            total_directory_count += level_width;
+            level_width *= static_cast<size_t>(runtime_configuration.synthetic_tree_fanout);
+            if (total_directory_count > 100000000) {
+                std::cerr << "--tree-depth and --tree-fanout describe more than 10^8 directories\n";
+                return false;
+            }
+        }
+    }
+    
+    // The external sort rides on the streaming pipeline; modes that hold every entry defeat the cap
+    if (runtime_configuration.sort_memory_limit_bytes > 0) {
+        if (runtime_configuration.duplicate_detection_enabled || runtime_configuration.move_planning_enabled ||
+            !runtime_configuration.incremental_index_path.empty() || runtime_configuration.throughput_measurement_enabled ||
+            runtime_configuration.output_format == RESULT_OUTPUT_BINARY) {
+            std::cerr << "--memory-limit cannot be combined with --dedupe, --plan, --index, --throughput or binary output\n";
+            return false;
+        }
+        std::error_code directory_error;
+        if (!runtime_configuration.sort_temporary_directory.empty() &&
+            !std::filesystem::is_directory(runtime_configuration.sort_temporary_directory, directory_error)) {
+            std::cerr << "--sort-temp-dir is not a directory: " << runtime_configuration.sort_temporary_directory << "\n";
+            return false;
+        }
+        runtime_configuration.streaming_pipeline_enabled = true;
+    } else if (runtime_configuration.sort_by_size_enabled || !runtime_configuration.sort_temporary_directory.empty()) {
+        std::cerr << "--sort-by-size and --sort-temp-dir require --memory-limit\n";
+        return false;
+    }
+    
+    // The daemon moves what arrives, so it needs a real tree and a destination; modes bound to
+    // one complete pass (plans, indexes, dedupe, throughput, shards) have no meaning for it
+    if (runtime_configuration.watch_mode_enabled) {
+#if defined(__linux__)
+        if (runtime_configuration.source_directory_path.empty() || runtime_configuration.destination_directory_path.empty()) {
+            std::cerr << "--watch requires --source and --destination\n";
+            return false;
+        }
+        if (runtime_configuration.move_planning_enabled || !runtime_configuration.incremental_index_path.empty() ||
+            runtime_configuration.duplicate_detection_enabled || runtime_configuration.throughput_measurement_enabled ||
+            !runtime_configuration.shard_manifest_path.empty() || !runtime_configuration.shard_report_path.empty()) {
+            std::cerr << "--watch cannot be combined with --plan, --index, --dedupe, --throughput, --shard or --shard-report\n";
+            return false;
+        }
+#else
+        std::cerr << "--watch is only supported on Linux (inotify)\n";
+        return false;
+#endif
+    }
+    
+    // Live counters are published by the walk-and-classify passes only
+    if (!runtime_configuration.statistics_file_path.empty()) {
+        if (runtime_configuration.source_directory_path.empty() || runtime_configuration.throughput_measurement_enabled) {
+            std::cerr << "--stats-file requires --source and cannot be combined with --throughput\n";
+            return false;
+        }
+        if (runtime_configuration.statistics_interval_seconds == 0.0) {
+            runtime_configuration.statistics_interval_seconds = LIVE_STATISTICS_DEFAULT_INTERVAL_SECONDS;
+        }
+    } else if (runtime_configuration.statistics_interval_seconds > 0.0) {
+        std::cerr << "--stats-interval requires --stats-file\n";
+        return false;
+    }
+    
+    // Quiet runs print nothing but the summary, so modes whose report is the result are rejected
+    if (runtime_configuration.quiet_mode_enabled &&
+        (runtime_configuration.throughput_measurement_enabled ||
+         (runtime_configuration.move_planning_enabled && runtime_configuration.move_plan_file_path.empty()))) {
+        std::cerr << "--quiet cannot be combined with --throughput or with --plan unless --plan-file is given\n";
+        return false;
+    }
+    
+    // Content sniffing reads real files
+    if (runtime_configuration.content_sniffing_enabled && runtime_configuration.source_directory_path.empty()) {
+        std::cerr << "--sniff requires --source\n";
+        return false;
+    }
+    
+    // Duplicate grouping needs every size of a real tree before any file is moved
+    if (runtime_configuration.duplicate_detection_enabled) {
+        if (runtime_configuration.source_directory_path.empty() || runtime_configuration.streaming_pipeline_enabled ||
+            runtime_configuration.throughput_measurement_enabled) {
+            std::cerr << "--dedupe requires --source and cannot be combined with --stream or --throughput\n";
+            return false;
+        }
+        runtime_configuration.metadata_collection_enabled = true;
+    }
+    
+    // File formats need a target; binary needs the full entry count before writing
+    if (runtime_configuration.output_format != RESULT_OUTPUT_TABLE && runtime_configuration.output_file_path.empty()) {
+        std::cerr << "--output-format binary/tsv requires --output-file\n";
+        return false;
+    }
+    if (runtime_configuration.output_format == RESULT_OUTPUT_BINARY && runtime_configuration.streaming_pipeline_enabled) {
+        std::cerr << "--output-format binary cannot be combined with --stream (use tsv)\n";
+        return false;
+    }
+    
+    // The index records real directories and relies on POSIX file identities
+    if (!runtime_configuration.incremental_index_path.empty()) {
+#if defined(ARTLEST_POSIX_FILE_OPERATIONS)
+        if (runtime_configuration.source_directory_path.empty() || runtime_configuration.throughput_measurement_enabled) {
+            std::cerr << "--index requires --source and cannot be combined with --throughput\n";
+            return false;
+        }
+        runtime_configuration.metadata_collection_enabled = true;
+#else
+        std::cerr << "--index is only supported on POSIX systems\n";
+        return false;
+#endif
+    }
+    
+    // Validate the source tree before the banner is displayed
+    if (!runtime_configuration.source_directory_path.empty()) {
+        std::error_code status_error;
+        if (!std::filesystem::is_directory(runtime_configuration.source_directory_path, status_error)) {
+            std::cerr << "Source is not a readable directory: " << runtime_configuration.source_directory_path << "\n";
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+/**
+ * main - Program entry point and execution controller
+ * This function serves as the primary execution controller for the file sorting
+ * system, managing initialization and termination procedures
+ */
+int main(int argc, char* argv[]) {
+#if defined(ARTLEST_ENABLE_INSTRUMENTATION)
+    // Before any thread exists, so every later thread inherits the blocked SIGUSR1
+    start_instrumentation_signal_listener();
+#endif
+    
+    // Translate command line options into runtime configuration
+    execution_configuration_parameters runtime_configuration;
+    if (!parse_command_line_arguments(argc, argv, runtime_configuration)) {
+        display_usage_information(argv[0]);
+        return 1;  // Indicate invalid invocation
+    }
+    if (runtime_configuration.usage_requested) {
+        display_usage_information(argv[0]);
+        return 0;
+    }
+#if defined(ARTLEST_ENABLE_INSTRUMENTATION)
+    instrumentation_exit_report exit_report;  // Stage timers and counters to stderr on every return below
+#endif
+    
+    // The self-test touches no files; it confirms the in-tree hash still matches the reference
+    if (runtime_configuration.self_test_requested) {
+        size_t checked_vector_count = 0;
+        bool vectors_match = verify_content_hasher_vectors(checked_vector_count);
+        std::cout << "XXH64 reference vectors: " << (vectors_match ? "passed" : "FAILED") << " (" << checked_vector_count << " checks)\n";
+        return vectors_match ? 0 : 1;
+    }
+    
+    // Compile user rules once, before any output; size rules need per-file metadata
+    rule_configuration_matcher rule_matcher;
+    if (!runtime_configuration.rule_file_path.empty()) {
+        std::string error_message;
+        if (!rule_matcher.load_rule_file(runtime_configuration.rule_file_path, error_message)) {
+            std::cerr << "Invalid rule file " << runtime_configuration.rule_file_path << ": " << error_message << "\n";
+            return 1;
+        }
+        if (rule_matcher.requires_file_sizes()) runtime_configuration.metadata_collection_enabled = true;
+    }
+    
+    // The coordinator split only writes manifests; nodes then run with --shard
+    if (runtime_configuration.shard_split_count > 0) {
+        return execute_shard_split(runtime_configuration) ? 0 : 1;
+    }
+    
+    // Merging reads shard reports only, so every report is validated before any output
+    std::vector<loaded_shard_report> shard_reports(runtime_configuration.merge_report_paths.size());
+    for (size_t report_index = 0; report_index < shard_reports.size(); ++report_index) {
+        std::string error_message;
+        if (!load_shard_report(runtime_configuration.merge_report_paths[report_index], shard_reports[report_index], error_message)) {
+            std::cerr << "Invalid shard report " << runtime_configuration.merge_report_paths[report_index] << ": " << error_message << "\n";
+            return 1;
+        }
+    }
+    
+    // A saved plan is validated completely before any output or move
+    loaded_move_plan replay_plan;
+    if (!runtime_configuration.replay_plan_path.empty()) {
+        std::string error_message;
+        if (!load_move_plan(runtime_configuration.replay_plan_path, replay_plan, error_message)) {
+            std::cerr << "Invalid move plan " << runtime_configuration.replay_plan_path << ": " << error_message << "\n";
+            return 1;
+        }
+    }
+    
+    // Tree generation only writes the dataset; classify it afterwards with --source
+    if (!runtime_configuration.synthetic_tree_path.empty()) {
+        return execute_tree_generation(runtime_configuration) ? 0 : 1;
+    }
+    
+    // Benchmark output is pure JSON, so it bypasses the banners
+    if (runtime_configuration.benchmark_mode_enabled) {
+        execute_benchmark_suite(runtime_configuration, BUILT_IN_EXTENSION_TABLE, rule_matcher);
+        return 0;
+    }
+    
+    // Quiet runs skip every banner and report; errors still reach stderr and the run ends with one summary line
+    bool report_output_enabled = !runtime_configuration.quiet_mode_enabled;
+    
+    // Display system initialization banner
+    if (report_output_enabled) {
+        std::cout << "╔══════════════════════════════════════════════════════════════╗\n";
+        std::cout << "║           PROFESSIONAL FILE CLASSIFICATION SYSTEM           ║\n";
+        std::cout << "║                Cross-Platform Implementation                 ║\n";
+        std::cout << "║            Code hints and optimizations by artlest          ║\n";
+        std::cout << "╚══════════════════════════════════════════════════════════════╝\n\n";
+        
+        if (rule_matcher.has_rules()) std::cout << "Rule Configuration: " << rule_matcher.describe_rules() << "\n\n";
+    }
+    
+    // Execute primary file sorting algorithm, or combine the reports of a sharded run
+    bool run_succeeded = true;
+    if (!shard_reports.empty()) {
+        display_shard_merge_report(runtime_configuration, shard_reports);
+    } else if (!runtime_configuration.replay_plan_path.empty()) {
+        run_succeeded = execute_move_plan_replay(runtime_configuration, replay_plan);
+    } else if (runtime_configuration.watch_mode_enabled) {
+        run_succeeded = execute_watch_daemon(runtime_configuration, rule_matcher);
+    } else {
+        run_succeeded = execute_file_sorting_algorithm(runtime_configuration, rule_matcher);
+    }
+    
+    // Failures were already reported on stderr; cron and scripts see them in the exit status
+    if (!run_succeeded) return 1;
+    
+    // Display successful completion status
+    if (report_output_enabled) {
+        std::cout << "\n╔══════════════════════════════════════════════════════════════╗\n";
+        std::cout << "║                   EXECUTION COMPLETED                        ║\n";
+        std::cout << "║              System terminated successfully                  ║\n";
+        std::cout << "╚══════════════════════════════════════════════════════════════╝\n";
+    }
     
     return 0;  // Indicate successful program termination
 }
\ No newline at end of file
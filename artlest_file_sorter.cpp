@@ -0,0 +1,948 @@
+/*
+ * Professional File Sorting Algorithm Implementation
+ * Classification Core Shared By The Sorter And Embedding Hosts
+ * Code hints and optimizations by artlest
+ * 
+ * Out-of-line definitions of artlest_file_sorter.h: io_uring ring setup,
+ * the file move executor, rule file compilation, priority ordering and the
+ * embedded coroutine sorter. Nothing here parses command lines, prints
+ * run reports or replaces the global allocator, so hosts link this file
+ * instead of the command line program.
+ */
+
+#include "artlest_file_sorter.h"
+
+#include <iostream>     // Move failure diagnostics
+#include <fstream>      // Rule file parsing
+#include <filesystem>   // Destination directory creation and the portable move path
+#include <cstdlib>      // Size threshold parsing
+#include <map>          // Subset numbering while compiling the rule automaton
+#include <cctype>       // Case folding of rule patterns
+#if defined(ARTLEST_POSIX_FILE_OPERATIONS)
+#include <fcntl.h>      // Directory descriptors and openat flags
+#include <sys/stat.h>   // File metadata for the copy fallback
+#include <sys/mman.h>   // io_uring ring mappings
+#if defined(__linux__)
+#include <sys/sendfile.h>  // In-kernel copy fallback
+#endif
+#endif
+
+#if defined(ARTLEST_ENABLE_INSTRUMENTATION)
+std::atomic<thread_instrumentation_counters*> instrumentation_registry_head{nullptr};  // Newest registered thread
+#endif
+
+#if defined(ARTLEST_IO_URING_AVAILABLE)
+io_uring_submission_ring::~io_uring_submission_ring() {
+    if (submission_entries != nullptr) munmap(submission_entries, submission_entries_size);
+    if (completion_ring_memory != nullptr && completion_ring_memory != submission_ring_memory) {
+        munmap(completion_ring_memory, completion_ring_size);
+    }
+    if (submission_ring_memory != nullptr) munmap(submission_ring_memory, submission_ring_size);
+    if (ring_descriptor >= 0) close(ring_descriptor);
+}
+
+bool io_uring_submission_ring::initialize_ring(unsigned queue_depth) {
+    io_uring_params ring_parameters;
+    std::memset(&ring_parameters, 0, sizeof(ring_parameters));
+    ring_descriptor = static_cast<int>(syscall(__NR_io_uring_setup, queue_depth, &ring_parameters));
+    if (ring_descriptor < 0) return false;
+    
+    // Map submission ring, completion ring (shared when supported) and entry array
+    submission_ring_size = ring_parameters.sq_off.array + ring_parameters.sq_entries * sizeof(unsigned);
+    completion_ring_size = ring_parameters.cq_off.cqes + ring_parameters.cq_entries * sizeof(io_uring_cqe);
+    bool single_mapping = (ring_parameters.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mapping) submission_ring_size = completion_ring_size = std::max(submission_ring_size, completion_ring_size);
+    submission_ring_memory = map_ring_region(submission_ring_size, IORING_OFF_SQ_RING);
+    completion_ring_memory = single_mapping ? submission_ring_memory : map_ring_region(completion_ring_size, IORING_OFF_CQ_RING);
+    submission_entries_size = ring_parameters.sq_entries * sizeof(io_uring_sqe);
+    submission_entries = static_cast<io_uring_sqe*>(map_ring_region(submission_entries_size, IORING_OFF_SQES));
+    if (submission_ring_memory == nullptr || completion_ring_memory == nullptr || submission_entries == nullptr) return false;
+    
+    char* submission_base = static_cast<char*>(submission_ring_memory);
+    char* completion_base = static_cast<char*>(completion_ring_memory);
+    submission_tail = reinterpret_cast<unsigned*>(submission_base + ring_parameters.sq_off.tail);
+    submission_mask = *reinterpret_cast<unsigned*>(submission_base + ring_parameters.sq_off.ring_mask);
+    submission_index_array = reinterpret_cast<unsigned*>(submission_base + ring_parameters.sq_off.array);
+    completion_head = reinterpret_cast<unsigned*>(completion_base + ring_parameters.cq_off.head);
+    completion_tail = reinterpret_cast<unsigned*>(completion_base + ring_parameters.cq_off.tail);
+    completion_mask = *reinterpret_cast<unsigned*>(completion_base + ring_parameters.cq_off.ring_mask);
+    completion_entries = reinterpret_cast<io_uring_cqe*>(completion_base + ring_parameters.cq_off.cqes);
+    submission_capacity = ring_parameters.sq_entries;
+    local_submission_tail = *submission_tail;
+    return true;
+}
+
+bool io_uring_submission_ring::supports_operation(unsigned operation_code) const {
+    const unsigned PROBE_OPERATION_COUNT = 256;
+    std::vector<char> probe_storage(sizeof(io_uring_probe) + PROBE_OPERATION_COUNT * sizeof(io_uring_probe_op), 0);
+    io_uring_probe* operation_probe = reinterpret_cast<io_uring_probe*>(probe_storage.data());
+    if (syscall(__NR_io_uring_register, ring_descriptor, IORING_REGISTER_PROBE, operation_probe, PROBE_OPERATION_COUNT) < 0) {
+        return false;
+    }
+    return operation_code <= operation_probe->last_op &&
+           (operation_probe->ops[operation_code].flags & IO_URING_OP_SUPPORTED) != 0;
+}
+
+void* io_uring_submission_ring::map_ring_region(size_t region_size, off_t region_offset) {
+    void* region = mmap(nullptr, region_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_descriptor, region_offset);
+    return region == MAP_FAILED ? nullptr : region;
+}
+
+std::unique_ptr<io_uring_submission_ring> create_io_uring_instance(std::initializer_list<unsigned> required_operations) {
+    std::unique_ptr<io_uring_submission_ring> submission_ring(new io_uring_submission_ring());
+    if (!submission_ring->initialize_ring(IO_URING_QUEUE_DEPTH)) return nullptr;
+    for (unsigned operation_code : required_operations) {
+        if (!submission_ring->supports_operation(operation_code)) return nullptr;
+    }
+    return submission_ring;
+}
+#endif
+
+void build_collision_candidate_name(std::string_view original_filename, int attempt_number, std::string& candidate_name) {
+    size_t extension_delimiter_position = original_filename.find_last_of('.');
+    if (extension_delimiter_position == 0 || extension_delimiter_position == std::string_view::npos) {
+        extension_delimiter_position = original_filename.size();
+    }
+    candidate_name.assign(original_filename.substr(0, extension_delimiter_position));
+    candidate_name += " (" + std::to_string(attempt_number) + ")";
+    candidate_name.append(original_filename.substr(extension_delimiter_position));
+}
+
+file_move_executor::file_move_executor() {
+    for (int category_index = 0; category_index < CLASSIFICATION_CATEGORY_COUNT; ++category_index) {
+        category_directory_descriptors[category_index] = -1;
+        category_noreplace_unsupported[category_index].store(false, std::memory_order_relaxed);
+    }
+}
+
+file_move_executor::~file_move_executor() {
+#if defined(ARTLEST_POSIX_FILE_OPERATIONS)
+    {
+        std::lock_guard<std::mutex> pool_guard(move_pool_lock);
+        move_pool_stopping = true;
+    }
+    move_pool_signal.notify_all();
+    for (std::thread& move_worker_thread : move_worker_threads) move_worker_thread.join();
+    for (int category_index = 0; category_index < CLASSIFICATION_CATEGORY_COUNT; ++category_index) {
+        if (category_directory_descriptors[category_index] >= 0) close(category_directory_descriptors[category_index]);
+    }
+#endif
+}
+
+bool file_move_executor::prepare_destination_directories(const std::string& destination_root_path, std::string* error_message) {
+    for (int category_index = 0; category_index < CLASSIFICATION_CATEGORY_COUNT; ++category_index) {
+        std::filesystem::path category_path =
+            std::filesystem::path(destination_root_path) / CLASSIFICATION_CATEGORY_TABLE[category_index].directory_name;
+        std::error_code creation_error;
+        std::filesystem::create_directories(category_path, creation_error);
+        if (creation_error) {
+            report_setup_failure("Cannot create destination directory " + category_path.string() + ": " +
+                                 creation_error.message(), error_message);
+            return false;
+        }
+        category_directory_paths[category_index] = category_path.string();
+#if defined(ARTLEST_POSIX_FILE_OPERATIONS)
+        category_directory_descriptors[category_index] =
+            open(category_directory_paths[category_index].c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (category_directory_descriptors[category_index] < 0) {
+            report_setup_failure("Cannot open destination directory " + category_directory_paths[category_index] + ": " +
+                                 std::strerror(errno), error_message);
+            return false;
+        }
+        struct stat directory_status;
+        if (fstat(category_directory_descriptors[category_index], &directory_status) == 0) {
+            category_device_identifiers[category_index] = static_cast<uint64_t>(directory_status.st_dev);
+        }
+#endif
+    }
+    return true;
+}
+
+bool file_move_executor::enable_io_uring_backend() {
+#if defined(ARTLEST_IO_URING_AVAILABLE)
+    rename_ring = create_io_uring_instance({IORING_OP_RENAMEAT});
+    return rename_ring != nullptr;
+#else
+    return false;
+#endif
+}
+
+bool file_move_executor::enable_adaptive_concurrency() {
+#if defined(ARTLEST_POSIX_FILE_OPERATIONS)
+    for (int category_index = 0; category_index < CLASSIFICATION_CATEGORY_COUNT; ++category_index) {
+        struct stat directory_status;
+        uint64_t device_identifier = 0;
+        if (category_directory_descriptors[category_index] >= 0 &&
+            fstat(category_directory_descriptors[category_index], &directory_status) == 0) {
+            device_identifier = static_cast<uint64_t>(directory_status.st_dev);
+        }
+        auto existing_limiter = std::find_if(device_concurrency_limiters.begin(), device_concurrency_limiters.end(),
+            [device_identifier](const std::unique_ptr<adaptive_concurrency_limiter>& device_limiter) {
+                return device_limiter->snapshot().device_identifier == device_identifier;
+            });
+        if (existing_limiter == device_concurrency_limiters.end()) {
+            device_concurrency_limiters.push_back(
+                std::make_unique<adaptive_concurrency_limiter>(device_identifier, ADAPTIVE_MAXIMUM_CONCURRENCY));
+            existing_limiter = device_concurrency_limiters.end() - 1;
+        }
+        category_concurrency_limiters[category_index] = existing_limiter->get();
+    }
+    // The batch caller moves chunks too, so one thread fewer fills every permit
+    while (move_worker_threads.size() + 1 < ADAPTIVE_MAXIMUM_CONCURRENCY) {
+        move_worker_threads.emplace_back([this] { execute_move_worker_loop(); });
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::vector<adaptive_concurrency_snapshot> file_move_executor::adaptive_concurrency_snapshots() const {
+    std::vector<adaptive_concurrency_snapshot> limit_snapshots;
+    for (const auto& device_limiter : device_concurrency_limiters) limit_snapshots.push_back(device_limiter->snapshot());
+    return limit_snapshots;
+}
+
+void file_move_executor::execute_move_batch(const file_classification_entry* entry_collection, size_t entry_count) {
+    ARTLEST_TIME_STAGE(STAGE_MOVE);
+#if defined(ARTLEST_POSIX_FILE_OPERATIONS)
+    bool concurrent_moves_possible = !device_concurrency_limiters.empty() && entry_count > ADAPTIVE_MOVE_CHUNK_LENGTH;
+#if defined(ARTLEST_IO_URING_AVAILABLE)
+    if (rename_ring) concurrent_moves_possible = false;  // The ring already keeps a whole run in flight
+#endif
+    if (concurrent_moves_possible) {
+        execute_move_batch_concurrently(entry_collection, entry_count);
+        publish_move_statistics();
+        return;
+    }
+    size_t run_start = 0;
+    while (run_start < entry_count) {
+        std::string_view run_directory_path = entry_collection[run_start].source_directory_path;
+        size_t run_end = run_start + 1;
+        while (run_end < entry_count && entry_collection[run_end].source_directory_path == run_directory_path) run_end++;
+        
+        int source_directory_descriptor = open(std::string(run_directory_path).c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (source_directory_descriptor < 0) {
+            int open_error = errno;
+            for (size_t entry_index = run_start; entry_index < run_end; ++entry_index) {
+                report_move_failure(entry_collection[entry_index], open_error);
+            }
+        } else {
+            relocate_directory_run(source_directory_descriptor, entry_collection + run_start, run_end - run_start);
+            close(source_directory_descriptor);
+        }
+        run_start = run_end;
+    }
+#else
+    for (size_t entry_index = 0; entry_index < entry_count; ++entry_index) {
+        relocate_entry_portably(entry_collection[entry_index]);
+    }
+#endif
+    publish_move_statistics();
+}
+
+#if defined(ARTLEST_POSIX_FILE_OPERATIONS)
+// Chunks never span directories, so each work item opens its source directory once
+void file_move_executor::execute_move_batch_concurrently(const file_classification_entry* entry_collection, size_t entry_count) {
+    std::vector<std::pair<size_t, size_t>> move_chunks;
+    size_t run_start = 0;
+    while (run_start < entry_count) {
+        std::string_view run_directory_path = entry_collection[run_start].source_directory_path;
+        size_t run_end = run_start + 1;
+        while (run_end < entry_count && entry_collection[run_end].source_directory_path == run_directory_path) run_end++;
+        for (size_t chunk_start = run_start; chunk_start < run_end; chunk_start += ADAPTIVE_MOVE_CHUNK_LENGTH) {
+            move_chunks.emplace_back(chunk_start, std::min(run_end, chunk_start + ADAPTIVE_MOVE_CHUNK_LENGTH));
+        }
+        run_start = run_end;
+    }
+    
+    // Hand the chunks to the pool; no more workers join than there are chunks besides the caller's
+    {
+        std::lock_guard<std::mutex> pool_guard(move_pool_lock);
+        pending_move_entries = entry_collection;
+        pending_move_chunks = std::move(move_chunks);
+        next_move_chunk_index.store(0, std::memory_order_relaxed);
+        open_move_worker_slots = std::min(pending_move_chunks.size() - 1, move_worker_threads.size());
+    }
+    move_pool_signal.notify_all();
+    move_pending_chunks();
+    
+    // Every chunk is claimed once the caller runs dry; withdraw unclaimed slots and wait for the rest
+    std::unique_lock<std::mutex> pool_guard(move_pool_lock);
+    open_move_worker_slots = 0;
+    move_pool_idle_signal.wait(pool_guard, [this] { return busy_move_worker_count == 0; });
+    pending_move_entries = nullptr;
+    pending_move_chunks.clear();
+}
+
+void file_move_executor::execute_move_worker_loop() {
+    std::unique_lock<std::mutex> pool_guard(move_pool_lock);
+    for (;;) {
+        move_pool_signal.wait(pool_guard, [this] { return move_pool_stopping || open_move_worker_slots > 0; });
+        if (move_pool_stopping) return;
+        open_move_worker_slots--;
+        busy_move_worker_count++;
+        pool_guard.unlock();
+        move_pending_chunks();
+        pool_guard.lock();
+        if (--busy_move_worker_count == 0) move_pool_idle_signal.notify_one();
+    }
+}
+
+// Threads beyond a device's current limit simply wait for a permit
+void file_move_executor::move_pending_chunks() {
+    file_move_statistics worker_statistics;
+    for (size_t chunk_index; (chunk_index = next_move_chunk_index.fetch_add(1)) < pending_move_chunks.size();) {
+        size_t chunk_start = pending_move_chunks[chunk_index].first;
+        size_t chunk_end = pending_move_chunks[chunk_index].second;
+        int source_directory_descriptor = open(std::string(pending_move_entries[chunk_start].source_directory_path).c_str(),
+                                               O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (source_directory_descriptor < 0) {
+            int open_error = errno;
+            for (size_t entry_index = chunk_start; entry_index < chunk_end; ++entry_index) {
+                report_move_failure(pending_move_entries[entry_index], open_error);
+            }
+            continue;
+        }
+        for (size_t entry_index = chunk_start; entry_index < chunk_end; ++entry_index) {
+            const file_classification_entry& current_entry = pending_move_entries[entry_index];
+            adaptive_concurrency_limiter::operation_permit move_permit(category_concurrency_limiters[current_entry.category_identifier]);
+            relocate_entry(source_directory_descriptor, current_entry, worker_statistics);
+        }
+        close(source_directory_descriptor);
+    }
+    std::lock_guard<std::mutex> statistics_guard(statistics_lock);
+    executor_statistics.files_renamed += worker_statistics.files_renamed;
+    executor_statistics.files_copied += worker_statistics.files_copied;
+    executor_statistics.collision_renames += worker_statistics.collision_renames;
+    executor_statistics.bytes_copied += worker_statistics.bytes_copied;
+}
+
+// Move every entry of one source directory, batching the first rename attempt when possible
+void file_move_executor::relocate_directory_run(int source_directory_descriptor, const file_classification_entry* run_entries, size_t run_length) {
+#if defined(ARTLEST_IO_URING_AVAILABLE)
+    if (rename_ring) {
+        const unsigned int RENAME_NOREPLACE_FLAG = 1;
+        const int RENAME_UNREPORTED = 1, RENAME_NOT_SUBMITTED = 2;  // Ring results are 0 or a negative errno
+        std::vector<int> rename_outcomes(run_length, RENAME_NOT_SUBMITTED);
+        
+        // Devices known to reject RENAME_NOREPLACE would only fail in the ring and repeat synchronously
+        std::vector<size_t> submitted_entry_indices;
+        submitted_entry_indices.reserve(run_length);
+        for (size_t entry_index = 0; entry_index < run_length; ++entry_index) {
+            if (category_noreplace_unsupported[run_entries[entry_index].category_identifier].load(std::memory_order_relaxed)) continue;
+            submitted_entry_indices.push_back(entry_index);
+            rename_outcomes[entry_index] = RENAME_UNREPORTED;
+        }
+        bool ring_usable = rename_ring->execute_operation_batch(submitted_entry_indices.size(),
+            [&](size_t operation_index, io_uring_sqe* submission_entry) {
+                const file_classification_entry& current_entry = run_entries[submitted_entry_indices[operation_index]];
+                submission_entry->opcode = IORING_OP_RENAMEAT;
+                submission_entry->fd = source_directory_descriptor;
+                submission_entry->addr = reinterpret_cast<uint64_t>(current_entry.filename_identifier.data());
+                submission_entry->len = static_cast<uint32_t>(category_directory_descriptors[current_entry.category_identifier]);
+                submission_entry->addr2 = reinterpret_cast<uint64_t>(current_entry.filename_identifier.data());
+                submission_entry->rename_flags = RENAME_NOREPLACE_FLAG;
+            },
+            [&](size_t operation_index, int operation_result) {
+                rename_outcomes[submitted_entry_indices[operation_index]] = operation_result;
+            });
+        if (!ring_usable) rename_ring.reset();  // Ring broke mid-run; finish on the synchronous path
+        for (size_t entry_index = 0; entry_index < run_length; ++entry_index) {
+            int rename_outcome = rename_outcomes[entry_index];
+            if (rename_outcome == 0) {
+                executor_statistics.files_renamed++;
+            } else if (rename_outcome == RENAME_UNREPORTED) {
+                report_move_failure(run_entries[entry_index], EIO);  // Kernel may still finish this rename; do not retry blindly
+            } else {
+                // The ring already tried the original name when it reports a collision
+                relocate_entry(source_directory_descriptor, run_entries[entry_index], executor_statistics,
+                               rename_outcome == -EEXIST ? 1 : 0);
+            }
+        }
+        return;
+    }
+#endif
+    for (size_t entry_index = 0; entry_index < run_length; ++entry_index) {
+        relocate_entry(source_directory_descriptor, run_entries[entry_index], executor_statistics);
+    }
+}
+
+// Try the original name, then numbered alternatives, falling back to copy across devices
+void file_move_executor::relocate_entry(int source_directory_descriptor, const file_classification_entry& current_entry,
+                                        file_move_statistics& outcome_statistics, int first_attempt_number) {
+    int destination_directory_descriptor = category_directory_descriptors[current_entry.category_identifier];
+    const char* source_filename = current_entry.filename_identifier.data();
+    std::string candidate_name;
+    const char* destination_filename = source_filename;
+    int move_result = EEXIST;
+    
+    for (int attempt_number = first_attempt_number; attempt_number < MAXIMUM_COLLISION_ATTEMPTS && move_result == EEXIST; ++attempt_number) {
+        if (attempt_number > 0) {
+            build_collision_candidate_name(current_entry.filename_identifier, attempt_number, candidate_name);
+            destination_filename = candidate_name.c_str();
+        }
+        
+        move_result = rename_without_replacement(source_directory_descriptor, source_filename,
+                                                 current_entry.category_identifier, destination_filename);
+        if (move_result == 0) {
+            outcome_statistics.files_renamed++;
+        } else if (move_result == EXDEV) {
+            move_result = copy_across_devices(source_directory_descriptor, source_filename,
+                                              destination_directory_descriptor, destination_filename, outcome_statistics);
+            if (move_result == 0) outcome_statistics.files_copied++;
+        }
+        if (move_result == 0 && attempt_number > 0) outcome_statistics.collision_renames++;
+    }
+    
+    if (move_result != 0) report_move_failure(current_entry, move_result);
+}
+
+/**
+ * rename_without_replacement - Moves a file unless the destination name exists
+ * Uses renameat2(RENAME_NOREPLACE); on a destination device that rejects
+ * the flag, falls back to linkat (which fails with EEXIST) plus unlinkat,
+ * so an existing file is never overwritten. Returns 0 or an errno value
+ */
+int file_move_executor::rename_without_replacement(int source_directory_descriptor, const char* source_filename,
+                                                   classification_category_identifier destination_category, const char* destination_filename) {
+    int destination_directory_descriptor = category_directory_descriptors[destination_category];
+#if defined(__linux__) && defined(SYS_renameat2)
+    if (!category_noreplace_unsupported[destination_category].load(std::memory_order_relaxed)) {
+        const unsigned int RENAME_NOREPLACE_FLAG = 1;
+        if (syscall(SYS_renameat2, source_directory_descriptor, source_filename, destination_directory_descriptor,
+                    destination_filename, RENAME_NOREPLACE_FLAG) == 0) {
+            return 0;
+        }
+        if (errno != EINVAL && errno != ENOSYS) return errno;
+        mark_noreplace_unsupported(category_device_identifiers[destination_category]);
+    }
+#endif
+    if (linkat(source_directory_descriptor, source_filename, destination_directory_descriptor, destination_filename, 0) != 0) {
+        if (errno == EPERM || errno == EOPNOTSUPP || errno == EMLINK) return EXDEV;  // No hard links here: copy with O_EXCL instead
+        return errno;
+    }
+    if (unlinkat(source_directory_descriptor, source_filename, 0) != 0) {
+        int unlink_error = errno;
+        unlinkat(destination_directory_descriptor, destination_filename, 0);  // Undo the link so the file is not duplicated
+        return unlink_error;
+    }
+    return 0;
+}
+
+// Every category directory on the given device stops trying RENAME_NOREPLACE
+void file_move_executor::mark_noreplace_unsupported(uint64_t device_identifier) {
+    for (int category_index = 0; category_index < CLASSIFICATION_CATEGORY_COUNT; ++category_index) {
+        if (category_device_identifiers[category_index] == device_identifier) {
+            category_noreplace_unsupported[category_index].store(true, std::memory_order_relaxed);
+        }
+    }
+}
+
+// Copy contents within the kernel where possible, then remove the source
+int file_move_executor::copy_across_devices(int source_directory_descriptor, const char* source_filename,
+                                            int destination_directory_descriptor, const char* destination_filename,
+                                            file_move_statistics& outcome_statistics) {
+    int source_descriptor = openat(source_directory_descriptor, source_filename, O_RDONLY | O_NOFOLLOW | O_CLOEXEC);
+    if (source_descriptor < 0) return errno;
+    struct stat source_status;
+    if (fstat(source_descriptor, &source_status) != 0) {
+        int status_error = errno;
+        close(source_descriptor);
+        return status_error;
+    }
+    int destination_descriptor = openat(destination_directory_descriptor, destination_filename,
+                                        O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, source_status.st_mode & 07777);
+    if (destination_descriptor < 0) {
+        int open_error = errno;
+        close(source_descriptor);
+        return open_error;
+    }
+    
+    int copy_result = copy_descriptor_contents(source_descriptor, destination_descriptor,
+                                               static_cast<unsigned long long>(source_status.st_size));
+#if defined(__linux__)
+    if (copy_result == 0) {
+        struct timespec preserved_times[2] = {source_status.st_atim, source_status.st_mtim};
+        futimens(destination_descriptor, preserved_times);
+    }
+#endif
+    if (close(destination_descriptor) != 0 && copy_result == 0) copy_result = errno;
+    close(source_descriptor);
+    
+    // Only drop the source once the copy is complete; never leave partial copies
+    if (copy_result == 0 && unlinkat(source_directory_descriptor, source_filename, 0) != 0) copy_result = errno;
+    if (copy_result != 0) {
+        unlinkat(destination_directory_descriptor, destination_filename, 0);
+        return copy_result;
+    }
+    outcome_statistics.bytes_copied += static_cast<unsigned long long>(source_status.st_size);
+    return 0;
+}
+
+// Transfer bytes with copy_file_range, then sendfile, then a read/write loop
+int file_move_executor::copy_descriptor_contents(int source_descriptor, int destination_descriptor, unsigned long long expected_bytes) {
+    unsigned long long bytes_transferred = 0;
+#if defined(__linux__)
+    bool kernel_copy_available = true;
+    while (kernel_copy_available && bytes_transferred < expected_bytes) {
+        ssize_t chunk_bytes = copy_file_range(source_descriptor, nullptr, destination_descriptor, nullptr,
+                                              COPY_FALLBACK_CHUNK_SIZE, 0);
+        if (chunk_bytes > 0) { bytes_transferred += chunk_bytes; continue; }
+        if (chunk_bytes == 0) return 0;  // Source shrank; copied everything present
+        if (errno == EINTR) continue;
+        if (errno != EXDEV && errno != EINVAL && errno != ENOSYS && errno != EOPNOTSUPP) return errno;
+        kernel_copy_available = false;
+    }
+    bool sendfile_available = true;
+    while (sendfile_available && bytes_transferred < expected_bytes) {
+        ssize_t chunk_bytes = sendfile(destination_descriptor, source_descriptor, nullptr, COPY_FALLBACK_CHUNK_SIZE);
+        if (chunk_bytes > 0) { bytes_transferred += chunk_bytes; continue; }
+        if (chunk_bytes == 0) return 0;
+        if (errno == EINTR) continue;
+        if (errno != EINVAL && errno != ENOSYS) return errno;
+        sendfile_available = false;
+    }
+#endif
+    std::unique_ptr<char[]> copy_buffer;
+    for (;;) {
+        if (!copy_buffer) copy_buffer.reset(new char[COPY_FALLBACK_CHUNK_SIZE]);
+        ssize_t read_bytes = read(source_descriptor, copy_buffer.get(), COPY_FALLBACK_CHUNK_SIZE);
+        if (read_bytes == 0) return 0;
+        if (read_bytes < 0) {
+            if (errno == EINTR) continue;
+            return errno;
+        }
+        for (ssize_t written_total = 0; written_total < read_bytes;) {
+            ssize_t written_bytes = write(destination_descriptor, copy_buffer.get() + written_total, read_bytes - written_total);
+            if (written_bytes < 0) {
+                if (errno == EINTR) continue;
+                return errno;
+            }
+            written_total += written_bytes;
+        }
+    }
+}
+#endif
+
+#if !defined(ARTLEST_POSIX_FILE_OPERATIONS)
+// Portable fallback built on std::filesystem when POSIX descriptors are unavailable
+void file_move_executor::relocate_entry_portably(const file_classification_entry& current_entry) {
+    std::filesystem::path source_path = std::filesystem::path(current_entry.source_directory_path) /
+                                        std::filesystem::path(current_entry.filename_identifier);
+    std::string candidate_name(current_entry.filename_identifier);
+    for (int attempt_number = 0; attempt_number < MAXIMUM_COLLISION_ATTEMPTS; ++attempt_number) {
+        if (attempt_number > 0) build_collision_candidate_name(current_entry.filename_identifier, attempt_number, candidate_name);
+        std::filesystem::path destination_path =
+            std::filesystem::path(category_directory_paths[current_entry.category_identifier]) / candidate_name;
+        std::error_code move_error;
+        if (std::filesystem::exists(destination_path, move_error)) continue;
+        std::filesystem::rename(source_path, destination_path, move_error);
+        if (!move_error) {
+            executor_statistics.files_renamed++;
+        } else if (std::filesystem::copy_file(source_path, destination_path, move_error) &&
+                   std::filesystem::remove(source_path, move_error)) {
+            executor_statistics.files_copied++;
+        } else {
+            report_move_failure(current_entry, move_error.value());
+            return;
+        }
+        if (attempt_number > 0) executor_statistics.collision_renames++;
+        return;
+    }
+    report_move_failure(current_entry, EEXIST);
+}
+#endif
+
+// Count a failure and print the first few so a bad run is diagnosable without flooding
+void file_move_executor::report_move_failure(const file_classification_entry& current_entry, int error_code) {
+    std::lock_guard<std::mutex> statistics_guard(statistics_lock);
+    if (++executor_statistics.failed_moves <= static_cast<size_t>(MAXIMUM_REPORTED_MOVE_ERRORS) && failure_reports_enabled) {
+        std::cerr << "\nMove failed: " << current_entry.source_directory_path << "/" << current_entry.filename_identifier
+                  << ": " << std::strerror(error_code) << "\n";
+    }
+}
+
+void file_move_executor::report_setup_failure(const std::string& failure_description, std::string* error_message) {
+    if (error_message != nullptr) {
+        *error_message = failure_description;
+    } else {
+        std::cerr << failure_description << "\n";
+    }
+}
+
+// Called by the driving thread once a batch is done (move threads have been joined)
+void file_move_executor::publish_move_statistics() {
+    published_files_renamed.store(executor_statistics.files_renamed, std::memory_order_relaxed);
+    published_files_copied.store(executor_statistics.files_copied, std::memory_order_relaxed);
+    published_collision_renames.store(executor_statistics.collision_renames, std::memory_order_relaxed);
+    published_failed_moves.store(executor_statistics.failed_moves, std::memory_order_relaxed);
+    published_bytes_copied.store(executor_statistics.bytes_copied, std::memory_order_relaxed);
+}
+
+bool rule_configuration_matcher::load_rule_file(const std::string& rule_file_path, std::string& error_message) {
+    std::ifstream rule_stream(rule_file_path);
+    if (!rule_stream) {
+        error_message = "cannot open " + rule_file_path;
+        return false;
+    }
+    
+    std::vector<std::pair<std::string, uint32_t>> name_patterns;  // Reversed lowercase globs with rule index
+    std::string rule_line;
+    for (int line_number = 1; std::getline(rule_stream, rule_line); ++line_number) {
+        size_t comment_position = rule_line.find('#');
+        if (comment_position != std::string::npos) rule_line.erase(comment_position);
+        std::vector<std::string> rule_fields;
+        for (size_t field_start = rule_line.find_first_not_of(" \t\r"); field_start != std::string::npos;) {
+            size_t field_end = rule_line.find_first_of(" \t\r", field_start);
+            rule_fields.push_back(rule_line.substr(field_start, field_end - field_start));
+            field_start = field_end == std::string::npos ? field_end : rule_line.find_first_not_of(" \t\r", field_end);
+        }
+        if (rule_fields.empty()) continue;
+        
+        classification_category_identifier rule_category = CLASSIFICATION_CATEGORY_COUNT;
+        if (rule_fields.size() == 3) {
+            for (int category_index = 0; category_index < CLASSIFICATION_CATEGORY_COUNT; ++category_index) {
+                if (rule_fields[2] == CLASSIFICATION_CATEGORY_TABLE[category_index].directory_name) {
+                    rule_category = static_cast<classification_category_identifier>(category_index);
+                }
+            }
+        }
+        if (rule_category == CLASSIFICATION_CATEGORY_COUNT) {
+            error_message = "line " + std::to_string(line_number) + ": expected \"<kind> <argument> <CATEGORY>\"";
+            return false;
+        }
+        
+        uint32_t rule_index = static_cast<uint32_t>(rule_categories.size());
+        const std::string& rule_kind = rule_fields[0];
+        std::string rule_argument = rule_fields[1];
+        if (rule_kind == "extension" || rule_kind == "glob") {
+            if (rule_kind == "extension") {
+                if (rule_argument[0] == '.') rule_argument.erase(0, 1);
+                if (rule_argument.empty() || rule_argument.find_first_of("*?") != std::string::npos) {
+                    error_message = "line " + std::to_string(line_number) + ": invalid extension";
+                    return false;
+                }
+                rule_argument = "*." + rule_argument;
+                extension_rule_count++;
+            } else {
+                glob_rule_count++;
+            }
+            std::transform(rule_argument.begin(), rule_argument.end(), rule_argument.begin(),
+                           [](unsigned char pattern_character) { return static_cast<char>(std::tolower(pattern_character)); });
+            std::reverse(rule_argument.begin(), rule_argument.end());
+            name_patterns.emplace_back(std::move(rule_argument), rule_index);
+        } else if (rule_kind == "size-above" || rule_kind == "size-below") {
+            uint64_t size_threshold = 0;
+            if (!parse_size_threshold(rule_argument, size_threshold)) {
+                error_message = "line " + std::to_string(line_number) + ": invalid size " + rule_argument;
+                return false;
+            }
+            (rule_kind == "size-above" ? size_above_rules : size_below_rules).push_back({size_threshold, rule_index});
+        } else if (rule_kind == "prefix") {
+            std::error_code canonical_error;
+            std::string canonical_prefix = std::filesystem::weakly_canonical(rule_argument, canonical_error).string();
+            if (!canonical_error) rule_argument = canonical_prefix;
+            while (rule_argument.size() > 1 && rule_argument.back() == '/') rule_argument.pop_back();
+            prefix_rule_indices.emplace(rule_argument, rule_index);  // Keeps the earliest duplicate
+            prefix_rule_count++;
+        } else {
+            error_message = "line " + std::to_string(line_number) + ": unknown rule kind " + rule_kind;
+            return false;
+        }
+        rule_categories.push_back(rule_category);
+    }
+    
+    prepare_size_thresholds();
+    return compile_name_automaton(name_patterns, error_message);
+}
+
+uint32_t rule_configuration_matcher::match_directory_prefix(std::string_view directory_path) const {
+    uint32_t matched_rule = NO_RULE_MATCH;
+    if (prefix_rule_indices.empty()) return matched_rule;
+    std::string ancestor_path(directory_path);
+    for (;;) {
+        auto prefix_position = prefix_rule_indices.find(ancestor_path);
+        if (prefix_position != prefix_rule_indices.end()) matched_rule = std::min(matched_rule, prefix_position->second);
+        size_t separator_position = ancestor_path.find_last_of('/');
+        if (separator_position == std::string::npos || ancestor_path.size() <= 1) break;
+        ancestor_path.erase(separator_position == 0 ? 1 : separator_position);
+    }
+    return matched_rule;
+}
+
+std::string rule_configuration_matcher::describe_rules() const {
+    return std::to_string(rule_count()) + " rules (" + std::to_string(extension_rule_count) + " extension, " +
+           std::to_string(glob_rule_count) + " glob, " + std::to_string(size_above_rules.size() + size_below_rules.size()) +
+           " size, " + std::to_string(prefix_rule_count) + " prefix), " + std::to_string(automaton_state_count()) + " DFA states";
+}
+
+bool rule_configuration_matcher::parse_size_threshold(const std::string& size_argument, uint64_t& size_threshold) {
+    char* parse_end = nullptr;
+    errno = 0;
+    unsigned long long parsed_value = std::strtoull(size_argument.c_str(), &parse_end, 10);
+    if (parse_end == size_argument.c_str() || errno != 0) return false;
+    std::string size_suffix(parse_end);
+    unsigned long long size_multiplier = size_suffix.empty() ? 1 : size_suffix == "K" ? 1ULL << 10
+                                       : size_suffix == "M" ? 1ULL << 20 : size_suffix == "G" ? 1ULL << 30 : 0;
+    if (size_multiplier == 0 || parsed_value > UINT64_MAX / size_multiplier) return false;
+    size_threshold = parsed_value * size_multiplier;
+    return true;
+}
+
+// Sort thresholds and fold in running minima so one binary search yields the earliest rule
+void rule_configuration_matcher::prepare_size_thresholds() {
+    auto by_threshold = [](const size_threshold_rule& left_rule, const size_threshold_rule& right_rule) {
+        return left_rule.size_threshold < right_rule.size_threshold;
+    };
+    std::stable_sort(size_above_rules.begin(), size_above_rules.end(), by_threshold);
+    for (size_t rule_position = 1; rule_position < size_above_rules.size(); ++rule_position) {
+        size_above_rules[rule_position].earliest_rule_index =
+            std::min(size_above_rules[rule_position].earliest_rule_index, size_above_rules[rule_position - 1].earliest_rule_index);
+    }
+    std::stable_sort(size_below_rules.begin(), size_below_rules.end(), by_threshold);
+    for (size_t rule_position = size_below_rules.size(); rule_position-- > 1;) {
+        size_below_rules[rule_position - 1].earliest_rule_index =
+            std::min(size_below_rules[rule_position - 1].earliest_rule_index, size_below_rules[rule_position].earliest_rule_index);
+    }
+}
+
+/**
+ * compile_name_automaton - Subset construction over all reversed glob patterns
+ * NFA states are (pattern, position) pairs; literal bytes get their own
+ * byte class and every other byte shares class 0, keeping the transition
+ * table at states x (distinct literals + 1) entries
+ */
+bool rule_configuration_matcher::compile_name_automaton(const std::vector<std::pair<std::string, uint32_t>>& name_patterns, std::string& error_message) {
+    if (name_patterns.empty()) return true;
+    
+    std::fill(std::begin(byte_class_map), std::end(byte_class_map), static_cast<uint16_t>(0));
+    uint16_t literal_byte_classes[256] = {};
+    byte_class_count = 1;
+    for (const auto& [pattern_text, rule_index] : name_patterns) {
+        for (unsigned char pattern_character : pattern_text) {
+            if (pattern_character == '*' || pattern_character == '?' || literal_byte_classes[pattern_character] != 0) continue;
+            literal_byte_classes[pattern_character] = static_cast<uint16_t>(byte_class_count++);
+        }
+    }
+    for (int byte_value = 0; byte_value < 256; ++byte_value) {
+        byte_class_map[byte_value] = literal_byte_classes[static_cast<unsigned char>(std::tolower(byte_value))];
+    }
+    
+    // Global NFA numbering: pattern_offsets[p] + position
+    std::vector<uint32_t> pattern_offsets(name_patterns.size() + 1, 0);
+    for (size_t pattern_index = 0; pattern_index < name_patterns.size(); ++pattern_index) {
+        pattern_offsets[pattern_index + 1] = pattern_offsets[pattern_index] + static_cast<uint32_t>(name_patterns[pattern_index].first.size()) + 1;
+    }
+    std::vector<uint32_t> nfa_state_pattern(pattern_offsets.back());
+    for (size_t pattern_index = 0; pattern_index < name_patterns.size(); ++pattern_index) {
+        std::fill(nfa_state_pattern.begin() + pattern_offsets[pattern_index], nfa_state_pattern.begin() + pattern_offsets[pattern_index + 1],
+                  static_cast<uint32_t>(pattern_index));
+    }
+    auto add_with_closure = [&](std::vector<uint32_t>& state_set, uint32_t nfa_state) {
+        const std::string& pattern_text = name_patterns[nfa_state_pattern[nfa_state]].first;
+        uint32_t pattern_position = nfa_state - pattern_offsets[nfa_state_pattern[nfa_state]];
+        state_set.push_back(nfa_state);
+        while (pattern_position < pattern_text.size() && pattern_text[pattern_position] == '*') {
+            state_set.push_back(++nfa_state);  // '*' may match the empty run
+            pattern_position++;
+        }
+    };
+    auto normalize_set = [](std::vector<uint32_t>& state_set) {
+        std::sort(state_set.begin(), state_set.end());
+        state_set.erase(std::unique(state_set.begin(), state_set.end()), state_set.end());
+    };
+    
+    std::map<std::vector<uint32_t>, uint32_t> state_numbering;
+    std::vector<std::vector<uint32_t>> state_sets;
+    auto intern_state = [&](std::vector<uint32_t>&& state_set) -> uint32_t {
+        auto [state_position, state_inserted] = state_numbering.emplace(state_set, static_cast<uint32_t>(state_sets.size()));
+        if (state_inserted) state_sets.push_back(std::move(state_set));
+        return state_position->second;
+    };
+    intern_state(std::vector<uint32_t>());
+    std::vector<uint32_t> start_set;
+    for (size_t pattern_index = 0; pattern_index < name_patterns.size(); ++pattern_index) {
+        add_with_closure(start_set, pattern_offsets[pattern_index]);
+    }
+    normalize_set(start_set);
+    intern_state(std::move(start_set));
+    
+    for (uint32_t state_index = 0; state_index < state_sets.size(); ++state_index) {
+        if (state_sets.size() > MAXIMUM_AUTOMATON_STATES) {
+            error_message = "glob rules expand to more than " + std::to_string(MAXIMUM_AUTOMATON_STATES) + " automaton states";
+            return false;
+        }
+        
+        // Accepting rule: the earliest pattern whose end position is in the set
+        uint32_t accepting_rule = NO_RULE_MATCH;
+        for (uint32_t nfa_state : state_sets[state_index]) {
+            uint32_t pattern_index = nfa_state_pattern[nfa_state];
+            if (nfa_state - pattern_offsets[pattern_index] == name_patterns[pattern_index].first.size()) {
+                accepting_rule = std::min(accepting_rule, name_patterns[pattern_index].second);
+            }
+        }
+        automaton_accepting_rules.push_back(accepting_rule);
+        
+        bool state_absorbing = true;
+        for (uint32_t byte_class = 0; byte_class < byte_class_count; ++byte_class) {
+            std::vector<uint32_t> next_set;
+            for (uint32_t nfa_state : state_sets[state_index]) {
+                uint32_t pattern_index = nfa_state_pattern[nfa_state];
+                const std::string& pattern_text = name_patterns[pattern_index].first;
+                uint32_t pattern_position = nfa_state - pattern_offsets[pattern_index];
+                if (pattern_position == pattern_text.size()) continue;
+                unsigned char pattern_character = static_cast<unsigned char>(pattern_text[pattern_position]);
+                if (pattern_character == '*') {
+                    add_with_closure(next_set, nfa_state);
+                } else if (pattern_character == '?' || literal_byte_classes[pattern_character] == byte_class) {
+                    add_with_closure(next_set, nfa_state + 1);
+                }
+            }
+            normalize_set(next_set);
+            uint32_t next_state = intern_state(std::move(next_set));
+            automaton_transitions.push_back(next_state);
+            if (next_state != state_index) state_absorbing = false;
+        }
+        automaton_absorbing_states.push_back(state_absorbing ? 1 : 0);
+    }
+    return true;
+}
+
+void apply_rule_configuration_to_entries(const rule_configuration_matcher& rule_matcher, std::string_view source_directory_path,
+                                         file_classification_entry* entry_collection, size_t entry_count) {
+    uint32_t directory_rule_index = rule_matcher.match_directory_prefix(source_directory_path);
+    for (size_t entry_index = 0; entry_index < entry_count; ++entry_index) {
+        file_classification_entry& current_entry = entry_collection[entry_index];
+        classification_category_identifier rule_category;
+        if (rule_matcher.match_entry(current_entry.filename_identifier, current_entry.file_size_bytes, directory_rule_index, rule_category)) {
+            current_entry.category_identifier = rule_category;
+            current_entry.processing_priority = calculate_processing_priority(rule_category);
+            current_entry.rule_classified = true;
+        }
+    }
+}
+
+void sort_entries_by_processing_priority(std::vector<file_classification_entry>& processed_file_results) {
+    // Count entries per priority level
+    size_t bucket_offsets[MAXIMUM_PRIORITY_LEVEL + 2] = {};
+    for (const file_classification_entry& processed_entry : processed_file_results) {
+        bucket_offsets[processed_entry.processing_priority + 1]++;
+    }
+    
+    // Convert counts into the first output position of each level
+    for (int priority_level = 1; priority_level <= MAXIMUM_PRIORITY_LEVEL + 1; ++priority_level) {
+        bucket_offsets[priority_level] += bucket_offsets[priority_level - 1];
+    }
+    
+    // Scatter entries into their buckets in original order
+    std::vector<file_classification_entry> sorted_results(processed_file_results.size());
+    for (const file_classification_entry& processed_entry : processed_file_results) {
+        sorted_results[bucket_offsets[processed_entry.processing_priority]++] = processed_entry;
+    }
+    processed_file_results.swap(sorted_results);
+}
+
+#if defined(ARTLEST_COROUTINE_API_AVAILABLE)
+embedded_file_sorter::embedded_file_sorter(resume_callback resume_on_event_loop)
+    : resume_awaiting_coroutine(std::move(resume_on_event_loop)),
+      io_thread([this] { execute_io_loop(); }) {
+    move_executor.suppress_failure_reports();
+}
+
+embedded_file_sorter::~embedded_file_sorter() {
+    {
+        std::lock_guard<std::mutex> queue_guard(job_lock);
+        stop_requested = true;
+    }
+    job_signal.notify_one();
+    io_thread.join();
+}
+
+bool embedded_file_sorter::open_destination(const std::string& destination_root_path, std::string& error_message) {
+    destination_ready = move_executor.prepare_destination_directories(destination_root_path, &error_message);
+    return destination_ready;
+}
+
+// Compiled into a fresh matcher so a failed or repeated load never mixes with the installed rules
+bool embedded_file_sorter::load_rules(const std::string& rule_file_path, std::string& error_message) {
+    rule_configuration_matcher loaded_matcher;
+    if (!loaded_matcher.load_rule_file(rule_file_path, error_message)) return false;
+    if (loaded_matcher.requires_file_sizes()) {
+        error_message = "size rules need file metadata, which the embedded API does not collect";
+        return false;
+    }
+    rule_matcher = std::move(loaded_matcher);
+    return true;
+}
+
+embedded_file_sorter::classify_awaitable embedded_file_sorter::classify_batch(std::span<const std::string_view> filenames,
+                                                                              std::string_view source_directory_path) const {
+    std::vector<file_classification_entry> classified_entries;
+    classified_entries.reserve(filenames.size());
+    for (std::string_view current_filename : filenames) {
+        classified_entries.push_back(classify_filename_entry(current_filename, BUILT_IN_EXTENSION_TABLE));
+        classified_entries.back().source_directory_path = source_directory_path;
+    }
+    if (rule_matcher.has_rules()) {
+        apply_rule_configuration_to_entries(rule_matcher, source_directory_path, classified_entries.data(),
+                                            classified_entries.size());
+    }
+    return classify_awaitable(std::move(classified_entries));
+}
+
+void embedded_file_sorter::submit_move(move_awaitable& awaiting_move, std::coroutine_handle<> awaiting_coroutine) {
+    {
+        std::lock_guard<std::mutex> queue_guard(job_lock);
+        pending_moves.push_back({&awaiting_move, awaiting_coroutine});
+    }
+    job_signal.notify_one();
+}
+
+// Runs every queued move, including those queued before a stop, then exits
+void embedded_file_sorter::execute_io_loop() {
+    std::unique_lock<std::mutex> queue_guard(job_lock);
+    for (;;) {
+        job_signal.wait(queue_guard, [this] { return stop_requested || !pending_moves.empty(); });
+        if (pending_moves.empty()) return;
+        queued_move current_move = pending_moves.front();
+        pending_moves.pop_front();
+        queue_guard.unlock();
+        execute_queued_move(*current_move.awaiting_move);
+        resume_awaiting_coroutine(current_move.awaiting_coroutine);
+        queue_guard.lock();
+    }
+}
+
+// Copy names into NUL-terminated storage, group by directory and move; the caller is suspended meanwhile
+void embedded_file_sorter::execute_queued_move(move_awaitable& awaiting_move) {
+    if (!destination_ready) {
+        awaiting_move.move_outcome.failed_moves = awaiting_move.entries.size();
+        return;
+    }
+    filename_storage_arena move_storage;
+    std::vector<file_classification_entry> owned_entries(awaiting_move.entries.begin(), awaiting_move.entries.end());
+    for (file_classification_entry& owned_entry : owned_entries) {
+        owned_entry.filename_identifier = move_storage.store_c_string(owned_entry.filename_identifier);
+        owned_entry.source_directory_path = move_storage.store_c_string(owned_entry.source_directory_path);
+    }
+    // One run per source directory keeps the executor to a single directory open each,
+    // with the highest priority first inside the run
+    std::stable_sort(owned_entries.begin(), owned_entries.end(),
+                     [](const file_classification_entry& left_entry, const file_classification_entry& right_entry) {
+                         if (left_entry.source_directory_path != right_entry.source_directory_path) {
+                             return left_entry.source_directory_path < right_entry.source_directory_path;
+                         }
+                         return left_entry.processing_priority < right_entry.processing_priority;
+                     });
+    
+    file_move_statistics statistics_before = move_executor.move_statistics();
+    move_executor.execute_move_batch(owned_entries.data(), owned_entries.size());
+    const file_move_statistics& statistics_after = move_executor.move_statistics();
+    awaiting_move.move_outcome.files_renamed = statistics_after.files_renamed - statistics_before.files_renamed;
+    awaiting_move.move_outcome.files_copied = statistics_after.files_copied - statistics_before.files_copied;
+    awaiting_move.move_outcome.collision_renames = statistics_after.collision_renames - statistics_before.collision_renames;
+    awaiting_move.move_outcome.failed_moves = statistics_after.failed_moves - statistics_before.failed_moves;
+    awaiting_move.move_outcome.bytes_copied = statistics_after.bytes_copied - statistics_before.bytes_copied;
+}
+#endif
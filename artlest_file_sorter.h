@@ -0,0 +1,1176 @@
+/*
+ * Professional File Sorting Algorithm Implementation
+ * Classification Core Shared By The Sorter And Embedding Hosts
+ * Code hints and optimizations by artlest
+ * 
+ * Category table, compile-time extension table, scalar classifier, user
+ * rules and the file move executor, plus the C++20 coroutine API for hosts.
+ * This header may be included from any number of translation units; the
+ * out-of-line definitions are compiled once from artlest_file_sorter.cpp.
+ * Build every translation unit with the same ARTLEST_ENABLE_INSTRUMENTATION
+ * setting, since the stage timers below are inlined into callers.
+ */
+
+#ifndef ARTLEST_FILE_SORTER_H
+#define ARTLEST_FILE_SORTER_H
+
+#include <string>       // String manipulation and processing utilities
+#include <string_view>  // Non-owning string references for allocation-free parsing
+#include <vector>       // Dynamic array container for file storage
+#include <algorithm>    // Standard algorithms for data processing
+#include <deque>        // Pending moves of the embedded sorter
+#include <thread>       // Move worker threads and the embedded sorter I/O thread
+#include <mutex>        // Statistics and limiter locks
+#include <atomic>       // Published move statistics and instrumentation counters
+#include <chrono>       // Latency samples of adaptive concurrency limits
+#include <functional>   // Resume callbacks of the embedded sorter
+#include <cstdint>      // Fixed-width integer types for packed keys
+#include <memory>       // Owning pointers for arena blocks and io_uring rings
+#include <cstring>      // Raw byte copies for filename storage
+#include <cerrno>       // Error codes reported by file move operations
+#include <cmath>        // Rounding of adaptive concurrency limits
+#include <unordered_map>  // Prefix rule lookup by directory path
+#include <condition_variable>  // Admission waits of adaptive concurrency limits
+#include <initializer_list>    // Required opcodes of io_uring instances
+#if defined(__unix__) || defined(__APPLE__)
+#define ARTLEST_POSIX_FILE_OPERATIONS 1
+#include <unistd.h>     // syscall, linkat, unlinkat and descriptor management
+#if defined(__linux__)
+#include <sys/syscall.h>   // renameat2 and io_uring system call numbers
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>  // io_uring submission/completion ABI
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) && defined(__NR_io_uring_register)
+#define ARTLEST_IO_URING_AVAILABLE 1
+#endif
+#endif
+#endif
+#endif
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L && __has_include(<coroutine>) && __has_include(<span>)
+#define ARTLEST_COROUTINE_API_AVAILABLE 1
+#include <coroutine>    // Awaitables of the embedded sorter API
+#include <span>         // Borrowed input ranges of the embedded sorter API
+#endif
+#if defined(ARTLEST_ENABLE_INSTRUMENTATION) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>  // __rdtsc for stage timers
+#elif defined(ARTLEST_ENABLE_INSTRUMENTATION) && defined(_M_X64)
+#include <intrin.h>     // __rdtsc for stage timers
+#endif
+
+// Configuration constants of the arena, the io_uring rings and the move executor
+const size_t FILENAME_ARENA_BLOCK_SIZE = 1 << 20;  // Default bytes per filename arena block
+const size_t FILENAME_ARENA_MAXIMUM_BLOCK_SIZE = 64 << 20;  // Largest single arena block
+const int MAXIMUM_COLLISION_ATTEMPTS = 1000;     // Alternative names tried when a destination exists
+const int MAXIMUM_REPORTED_MOVE_ERRORS = 20;     // Move failures printed before output is suppressed
+const size_t COPY_FALLBACK_CHUNK_SIZE = 1 << 20; // Bytes per cross-device copy request
+const unsigned IO_URING_QUEUE_DEPTH = 1024;      // Metadata operations in flight per io_uring instance
+const size_t ADAPTIVE_MAXIMUM_CONCURRENCY = 64;              // Worker threads behind each adaptive limit
+const size_t ADAPTIVE_INITIAL_CONCURRENCY = 4;               // In-flight operations admitted before any feedback
+const double ADAPTIVE_LATENCY_TOLERANCE = 1.5;               // Smoothed latency above baseline times this is congestion
+const double ADAPTIVE_DECREASE_FACTOR = 0.7;                 // Multiplicative cut applied on congestion
+const double ADAPTIVE_LATENCY_SMOOTHING = 0.2;               // EWMA weight of each new latency sample
+const double ADAPTIVE_BASELINE_DRIFT = 0.02;                 // Per-round upward drift of the latency baseline
+const size_t ADAPTIVE_MOVE_CHUNK_LENGTH = 64;                // Entries per concurrent move work item
+
+// Compact classification category identifiers used as table indices
+enum classification_category_identifier : uint8_t {
+    CATEGORY_DOCUMENTS_REPOSITORY,            // Professional document files
+    CATEGORY_MULTIMEDIA_ASSETS,               // Image and graphic assets
+    CATEGORY_AUDIO_LIBRARY,                   // Sound recordings and music
+    CATEGORY_VIDEO_CONTENT,                   // Video recordings and clips
+    CATEGORY_ARCHIVE_STORAGE,                 // Compressed archives
+    CATEGORY_SOURCE_CODE,                     // Development resources
+    CATEGORY_MISCELLANEOUS_FILES,             // Unclassified files
+    CLASSIFICATION_CATEGORY_COUNT             // Number of categories (not a category)
+};
+
+const int MAXIMUM_PRIORITY_LEVEL = 5;             // Lowest (numerically largest) processing priority
+
+// Static attributes shared by every file of one classification category
+struct classification_category_descriptor {
+    const char* directory_name;               // Destination directory name
+    uint8_t processing_priority;              // Sorting priority level (1 is highest)
+};
+
+// Directory names and priorities indexed by classification category identifier
+inline constexpr classification_category_descriptor CLASSIFICATION_CATEGORY_TABLE[CLASSIFICATION_CATEGORY_COUNT] = {
+    {"DOCUMENTS_REPOSITORY", 1},              // High priority for critical document files
+    {"MULTIMEDIA_ASSETS", 3},                 // Standard priority for multimedia and media assets
+    {"AUDIO_LIBRARY", 3},
+    {"VIDEO_CONTENT", 3},
+    {"ARCHIVE_STORAGE", 4},                   // Lower priority for compressed archives
+    {"SOURCE_CODE", 2},                       // Medium priority for source code and development files
+    {"MISCELLANEOUS_FILES", 5}                // Lowest priority for miscellaneous and unclassified files
+};
+
+// File classification data structure definition (trivially copyable; the
+// names are borrowed from a filename_storage_arena or the input batch)
+struct file_classification_entry {
+    std::string_view filename_identifier;     // Original filename string (NUL-terminated in storage)
+    std::string_view source_directory_path;   // Directory containing the file (empty for demo data)
+    uint64_t file_size_bytes;                 // File size when metadata was collected (otherwise 0)
+    classification_category_identifier category_identifier;  // Destination category
+    uint8_t processing_priority;              // Sorting priority level
+    uint32_t duplicate_group_identifier = 0;  // Identical-content group (0 when unique or not checked)
+    bool redundant_duplicate = false;         // Another member of the group is kept instead
+    bool rule_classified = false;             // A user rule chose the category, so sniffing skips it
+};
+
+// Single extension-to-category rule of the built-in classification database
+struct extension_classification_rule {
+    const char* file_extension;                        // Lowercase extension without the dot
+    classification_category_identifier category_identifier;  // Destination category
+};
+
+/**
+ * EXTENSION_CLASSIFICATION_RULES - Built-in file extension classification database
+ * This table associates file extensions with their corresponding directory
+ * categories for professional file organization
+ */
+inline constexpr extension_classification_rule EXTENSION_CLASSIFICATION_RULES[] = {
+    // Document file extensions mapping to professional categories
+    {"txt", CATEGORY_DOCUMENTS_REPOSITORY}, {"doc", CATEGORY_DOCUMENTS_REPOSITORY},
+    {"docx", CATEGORY_DOCUMENTS_REPOSITORY}, {"pdf", CATEGORY_DOCUMENTS_REPOSITORY},
+    {"rtf", CATEGORY_DOCUMENTS_REPOSITORY},
+    
+    // Multimedia file extensions for media asset management
+    {"jpg", CATEGORY_MULTIMEDIA_ASSETS}, {"jpeg", CATEGORY_MULTIMEDIA_ASSETS},
+    {"png", CATEGORY_MULTIMEDIA_ASSETS}, {"gif", CATEGORY_MULTIMEDIA_ASSETS},
+    {"bmp", CATEGORY_MULTIMEDIA_ASSETS},
+    
+    // Audio file extensions for sound library organization
+    {"mp3", CATEGORY_AUDIO_LIBRARY}, {"wav", CATEGORY_AUDIO_LIBRARY},
+    {"flac", CATEGORY_AUDIO_LIBRARY}, {"aac", CATEGORY_AUDIO_LIBRARY},
+    
+    // Video file extensions for video content management
+    {"mp4", CATEGORY_VIDEO_CONTENT}, {"avi", CATEGORY_VIDEO_CONTENT},
+    {"mkv", CATEGORY_VIDEO_CONTENT}, {"mov", CATEGORY_VIDEO_CONTENT},
+    
+    // Archive file extensions for compressed data storage
+    {"zip", CATEGORY_ARCHIVE_STORAGE}, {"rar", CATEGORY_ARCHIVE_STORAGE},
+    {"7z", CATEGORY_ARCHIVE_STORAGE}, {"tar", CATEGORY_ARCHIVE_STORAGE},
+    
+    // Source code file extensions for development resources
+    {"cpp", CATEGORY_SOURCE_CODE}, {"c", CATEGORY_SOURCE_CODE},
+    {"py", CATEGORY_SOURCE_CODE}, {"java", CATEGORY_SOURCE_CODE},
+    {"js", CATEGORY_SOURCE_CODE}, {"html", CATEGORY_SOURCE_CODE}
+};
+
+/**
+ * extension_classification_table - Perfect-hash extension lookup table
+ * Extensions of up to eight characters are packed into a 64-bit key and
+ * placed with a multiplicative hash whose multiplier is searched until no
+ * two keys share a slot, so a lookup is one multiply, one shift and one
+ * integer compare with no heap allocation. Construction is constexpr so the
+ * built-in table is generated entirely at compile time; rule sets that admit
+ * no perfect multiplier fall back to bounded linear probing
+ */
+class extension_classification_table {
+public:
+    static constexpr int MAXIMUM_TABLE_BITS = 9;                    // Largest table is 512 slots
+    static constexpr size_t MAXIMUM_PACKED_EXTENSION_LENGTH = 8;     // Bytes that fit in a packed key
+
+    constexpr extension_classification_table(const extension_classification_rule* rule_collection, size_t rule_count)
+        : table_slots{} {
+        // Gather distinct packed keys, letting later rules override earlier ones
+        size_t distinct_key_count = 0;
+        uint64_t distinct_keys[(size_t(1) << MAXIMUM_TABLE_BITS) / 2] = {};
+        classification_category_identifier distinct_categories[(size_t(1) << MAXIMUM_TABLE_BITS) / 2] = {};
+        for (size_t rule_index = 0; rule_index < rule_count; ++rule_index) {
+            size_t extension_length = 0;
+            while (rule_collection[rule_index].file_extension[extension_length] != '\0') ++extension_length;
+            if (extension_length == 0 || extension_length > MAXIMUM_PACKED_EXTENSION_LENGTH) {
+                throw "extension rules must be 1-8 characters";
+            }
+            uint64_t packed_key = pack_extension_key(rule_collection[rule_index].file_extension, extension_length);
+            size_t key_index = 0;
+            while (key_index < distinct_key_count && distinct_keys[key_index] != packed_key) ++key_index;
+            if (key_index == distinct_key_count) {
+                if (distinct_key_count == sizeof(distinct_keys) / sizeof(distinct_keys[0])) {
+                    throw "too many extension rules for the lookup table";
+                }
+                distinct_keys[distinct_key_count++] = packed_key;
+            }
+            distinct_categories[key_index] = rule_collection[rule_index].category_identifier;
+            if (extension_length > maximum_extension_length) maximum_extension_length = extension_length;
+        }
+        
+        // Search for a collision-free multiplier, growing the table when needed
+        table_bits = 1;
+        while ((size_t(1) << table_bits) < distinct_key_count * 2) ++table_bits;
+        uint64_t candidate_state = 0x9E3779B97F4A7C15ull;
+        for (; table_bits <= MAXIMUM_TABLE_BITS; ++table_bits) {
+            for (int attempt_index = 0; attempt_index < 256; ++attempt_index) {
+                candidate_state = candidate_state * 6364136223846793005ull + 1442695040888963407ull;
+                hash_multiplier = candidate_state | 1;
+                if (is_collision_free(distinct_keys, distinct_key_count)) {
+                    for (size_t key_index = 0; key_index < distinct_key_count; ++key_index) {
+                        table_slots[compute_slot_index(distinct_keys[key_index])] = {distinct_keys[key_index], distinct_categories[key_index]};
+                    }
+                    maximum_probe_distance = 1;
+                    return;
+                }
+            }
+        }
+        
+        // Fall back to linear probing over the largest table
+        table_bits = MAXIMUM_TABLE_BITS;
+        maximum_probe_distance = 1;
+        for (size_t key_index = 0; key_index < distinct_key_count; ++key_index) {
+            size_t probe_distance = 0;
+            size_t slot_index = compute_slot_index(distinct_keys[key_index]);
+            while (table_slots[slot_index].packed_key != 0) {
+                slot_index = (slot_index + 1) & ((size_t(1) << table_bits) - 1);
+                ++probe_distance;
+            }
+            table_slots[slot_index] = {distinct_keys[key_index], distinct_categories[key_index]};
+            if (probe_distance + 1 > maximum_probe_distance) maximum_probe_distance = probe_distance + 1;
+        }
+    }
+
+    // Resolve an already-lowercased extension; returns false when it is not registered
+    bool find_category(const char* extension_characters, size_t extension_length,
+                       classification_category_identifier& category_identifier) const {
+        if (extension_length == 0 || extension_length > maximum_extension_length) return false;
+        return find_category_by_packed_key(pack_extension_key(extension_characters, extension_length), category_identifier);
+    }
+
+    // Resolve a lowercased extension already packed little-endian into a key
+    bool find_category_by_packed_key(uint64_t packed_key, classification_category_identifier& category_identifier) const {
+        size_t slot_index = compute_slot_index(packed_key);
+        for (size_t probe_index = 0; probe_index < maximum_probe_distance; ++probe_index) {
+            const table_slot& candidate_slot = table_slots[slot_index];
+            if (candidate_slot.packed_key == packed_key) {
+                category_identifier = candidate_slot.category_identifier;
+                return true;
+            }
+            if (candidate_slot.packed_key == 0) return false;
+            slot_index = (slot_index + 1) & ((size_t(1) << table_bits) - 1);
+        }
+        return false;
+    }
+
+    // Length of the longest registered extension, used to reject long extensions early
+    constexpr size_t longest_extension_length() const { return maximum_extension_length; }
+
+private:
+    struct table_slot {
+        uint64_t packed_key;                                // Packed extension bytes (0 marks empty)
+        classification_category_identifier category_identifier;  // Category stored for the key
+    };
+
+    // Pack up to eight bytes little-endian into one integer key
+    static constexpr uint64_t pack_extension_key(const char* extension_characters, size_t extension_length) {
+        uint64_t packed_key = 0;
+        for (size_t character_index = 0; character_index < extension_length; ++character_index) {
+            packed_key |= static_cast<uint64_t>(static_cast<unsigned char>(extension_characters[character_index])) << (8 * character_index);
+        }
+        return packed_key;
+    }
+
+    constexpr size_t compute_slot_index(uint64_t packed_key) const {
+        return static_cast<size_t>((packed_key * hash_multiplier) >> (64 - table_bits));
+    }
+
+    constexpr bool is_collision_free(const uint64_t* distinct_keys, size_t distinct_key_count) const {
+        bool occupied_slots[size_t(1) << MAXIMUM_TABLE_BITS] = {};
+        for (size_t key_index = 0; key_index < distinct_key_count; ++key_index) {
+            size_t slot_index = compute_slot_index(distinct_keys[key_index]);
+            if (occupied_slots[slot_index]) return false;
+            occupied_slots[slot_index] = true;
+        }
+        return true;
+    }
+
+    table_slot table_slots[size_t(1) << MAXIMUM_TABLE_BITS];   // Open-addressed slot storage
+    uint64_t hash_multiplier = 1;                               // Multiplicative hash constant
+    int table_bits = 1;                                         // log2 of the active slot count
+    size_t maximum_probe_distance = 1;                          // Probes needed for any key
+    size_t maximum_extension_length = 0;                        // Longest registered extension
+};
+
+// Stack buffer size for lowercased extensions (longest extension a table can hold)
+constexpr size_t EXTENSION_BUFFER_CAPACITY = extension_classification_table::MAXIMUM_PACKED_EXTENSION_LENGTH;
+
+/**
+ * BUILT_IN_EXTENSION_TABLE - Compile-time perfect hash of the built-in rules
+ * Generated from EXTENSION_CLASSIFICATION_RULES during compilation, so no
+ * registry construction work happens at program start
+ */
+inline constexpr extension_classification_table BUILT_IN_EXTENSION_TABLE(
+    EXTENSION_CLASSIFICATION_RULES, sizeof(EXTENSION_CLASSIFICATION_RULES) / sizeof(EXTENSION_CLASSIFICATION_RULES[0]));
+
+#if defined(ARTLEST_ENABLE_INSTRUMENTATION)
+// Pipeline stages timed by the built-in instrumentation
+enum instrumentation_stage : uint8_t {
+    STAGE_WALK,                               // Directory enumeration and metadata collection
+    STAGE_EXTRACT,                            // Scalar extension extraction
+    STAGE_LOOKUP,                             // Scalar extension table lookup
+    STAGE_BATCH_CLASSIFY,                     // Packed batch kernel (fused extract and lookup)
+    STAGE_PRIORITY,                           // Priority assignment
+    STAGE_MOVE,                               // File relocation batches
+    STAGE_REPORT,                             // Result tables, result files and statistics
+    INSTRUMENTATION_STAGE_COUNT               // Number of stages (not a stage)
+};
+
+/**
+ * thread_instrumentation_counters - Stage timers and lookup counters of one thread
+ * Only the owning thread writes (plain load/store, no read-modify-write), so the
+ * atomics exist purely to let a report sample them while workers are running.
+ * Blocks are linked into a global list and never freed, so counters of threads
+ * that have exited still appear in the final report
+ */
+struct alignas(64) thread_instrumentation_counters {
+    std::atomic<uint64_t> stage_ticks[INSTRUMENTATION_STAGE_COUNT] = {};        // Timer ticks spent per stage
+    std::atomic<uint64_t> stage_invocations[INSTRUMENTATION_STAGE_COUNT] = {};  // Timed sections per stage
+    std::atomic<uint64_t> lookup_hits[CLASSIFICATION_CATEGORY_COUNT] = {};      // Registered extensions found, by category
+    std::atomic<uint64_t> lookup_misses{0};                                     // Names without a registered extension
+    thread_instrumentation_counters* next_registered = nullptr;                 // Next block in the global list
+};
+
+extern std::atomic<thread_instrumentation_counters*> instrumentation_registry_head;  // Newest registered thread (artlest_file_sorter.cpp)
+
+inline void add_owned_counter(std::atomic<uint64_t>& owned_counter, uint64_t increment) {
+    owned_counter.store(owned_counter.load(std::memory_order_relaxed) + increment, std::memory_order_relaxed);
+}
+
+// Counter block of the calling thread, registered on first use
+inline thread_instrumentation_counters& local_instrumentation_counters() {
+    thread_local thread_instrumentation_counters* local_counters = [] {
+        thread_instrumentation_counters* registered_counters = new thread_instrumentation_counters();
+        registered_counters->next_registered = instrumentation_registry_head.load(std::memory_order_relaxed);
+        while (!instrumentation_registry_head.compare_exchange_weak(registered_counters->next_registered, registered_counters,
+                                                                    std::memory_order_release, std::memory_order_relaxed)) {}
+        return registered_counters;
+    }();
+    return *local_counters;
+}
+
+// Cheap monotonic tick source: the time stamp counter on x86, steady_clock elsewhere
+inline uint64_t read_instrumentation_ticks() {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+/**
+ * scoped_stage_timer - Adds the ticks between construction and stop() to a stage
+ * stop() may be called early; the destructor stops a timer still running
+ */
+class scoped_stage_timer {
+public:
+    explicit scoped_stage_timer(instrumentation_stage timed_stage)
+        : timed_stage(timed_stage), start_ticks(read_instrumentation_ticks()) {}
+    ~scoped_stage_timer() { stop(); }
+    scoped_stage_timer(const scoped_stage_timer&) = delete;
+    scoped_stage_timer& operator=(const scoped_stage_timer&) = delete;
+    
+    void stop() {
+        if (timer_stopped) return;
+        timer_stopped = true;
+        thread_instrumentation_counters& thread_counters = local_instrumentation_counters();
+        add_owned_counter(thread_counters.stage_ticks[timed_stage], read_instrumentation_ticks() - start_ticks);
+        add_owned_counter(thread_counters.stage_invocations[timed_stage], 1);
+    }
+
+private:
+    instrumentation_stage timed_stage;        // Stage receiving the elapsed ticks
+    uint64_t start_ticks;                     // Tick reading at construction
+    bool timer_stopped = false;               // Ticks already recorded
+};
+
+inline void record_lookup_outcome(classification_category_identifier category_identifier, bool extension_registered) {
+    thread_instrumentation_counters& thread_counters = local_instrumentation_counters();
+    if (extension_registered) {
+        add_owned_counter(thread_counters.lookup_hits[category_identifier], 1);
+    } else {
+        add_owned_counter(thread_counters.lookup_misses, 1);
+    }
+}
+
+#define ARTLEST_TIME_STAGE(stage) scoped_stage_timer ARTLEST_SCOPED_TIMER_NAME(__LINE__)(stage)
+#define ARTLEST_SCOPED_TIMER_NAME(line_number) ARTLEST_SCOPED_TIMER_NAME_EXPANDED(line_number)
+#define ARTLEST_SCOPED_TIMER_NAME_EXPANDED(line_number) scoped_stage_timer_##line_number
+#define ARTLEST_BEGIN_STAGE(timer_name, stage) scoped_stage_timer timer_name(stage)
+#define ARTLEST_END_STAGE(timer_name) timer_name.stop()
+#define ARTLEST_COUNT_LOOKUP(category_identifier, extension_registered) \
+    record_lookup_outcome(category_identifier, extension_registered)
+#else
+// Instrumentation compiled out: every hook expands to an empty statement
+#define ARTLEST_TIME_STAGE(stage) do {} while (0)
+#define ARTLEST_BEGIN_STAGE(timer_name, stage) do {} while (0)
+#define ARTLEST_END_STAGE(timer_name) do {} while (0)
+#define ARTLEST_COUNT_LOOKUP(category_identifier, extension_registered) do { (void)(extension_registered); } while (0)
+#endif
+
+/**
+ * extract_file_extension_identifier - Processes filename to extract extension
+ * This function scans backwards from the end of the filename for the extension
+ * delimiter and lowercases the extension into the caller's fixed buffer, so no
+ * allocation is performed. Only the last maximum_extension_length + 1 bytes are
+ * examined: a longer extension cannot match any registered rule and is
+ * rejected without scanning the rest of the name
+ */
+inline std::string_view extract_file_extension_identifier(std::string_view filename_input,
+                                                          char (&lowercase_buffer)[EXTENSION_BUFFER_CAPACITY],
+                                                          size_t maximum_extension_length) {
+    ARTLEST_TIME_STAGE(STAGE_EXTRACT);
+    // Never examine more characters than the buffer can hold
+    if (maximum_extension_length > EXTENSION_BUFFER_CAPACITY) maximum_extension_length = EXTENSION_BUFFER_CAPACITY;
+    size_t scan_limit = std::min(filename_input.size(), maximum_extension_length + 1);
+    
+    // Locate the last dot character within the permitted suffix window
+    for (size_t suffix_offset = 1; suffix_offset <= scan_limit; ++suffix_offset) {
+        if (filename_input[filename_input.size() - suffix_offset] != '.') continue;
+        
+        // Validate that the extension delimiter is not the final character
+        size_t extension_length = suffix_offset - 1;
+        if (extension_length == 0) return std::string_view();
+        
+        // Convert extension to ASCII lowercase for standardized comparison
+        const char* extension_source = filename_input.data() + filename_input.size() - extension_length;
+        for (size_t character_index = 0; character_index < extension_length; ++character_index) {
+            char current_character = extension_source[character_index];
+            lowercase_buffer[character_index] = (current_character >= 'A' && current_character <= 'Z')
+                                                    ? static_cast<char>(current_character + ('a' - 'A'))
+                                                    : current_character;
+        }
+        return std::string_view(lowercase_buffer, extension_length);
+    }
+    
+    // Return empty view if no valid (or no registrable) extension detected
+    return std::string_view();
+}
+
+/**
+ * determine_classification_category - Maps file extension to directory category
+ * This function implements lookup algorithms to determine appropriate storage
+ * location based on file extension classification system
+ */
+inline classification_category_identifier determine_classification_category(std::string_view file_extension,
+                                                                             const extension_classification_table& mapping_registry) {
+    ARTLEST_TIME_STAGE(STAGE_LOOKUP);
+    // Perform lookup operation in extension classification table
+    classification_category_identifier category_identifier = CATEGORY_MISCELLANEOUS_FILES;
+    
+    // Unregistered extensions retain the default miscellaneous category
+    bool extension_registered = mapping_registry.find_category(file_extension.data(), file_extension.size(), category_identifier);
+    ARTLEST_COUNT_LOOKUP(category_identifier, extension_registered);
+    return category_identifier;
+}
+
+/**
+ * calculate_processing_priority - Determines file processing priority level
+ * This function implements priority calculation algorithms based on file
+ * characteristics and classification requirements
+ */
+inline uint8_t calculate_processing_priority(classification_category_identifier category_identifier) {
+    ARTLEST_TIME_STAGE(STAGE_PRIORITY);
+    // Priorities are a static attribute of each category
+    return CLASSIFICATION_CATEGORY_TABLE[category_identifier].processing_priority;
+}
+
+/**
+ * classify_filename_entry - Runs the extract/lookup/priority chain for one filename
+ * This function produces the complete classification record for a single file
+ * so that demonstration and filesystem inputs share one classification path
+ */
+inline file_classification_entry classify_filename_entry(std::string_view current_filename,
+                                                         const extension_classification_table& mapping_registry) {
+    // Extract file extension into stack storage for classification processing
+    char extension_buffer[EXTENSION_BUFFER_CAPACITY];
+    std::string_view file_extension_identifier = extract_file_extension_identifier(
+        current_filename, extension_buffer, mapping_registry.longest_extension_length());
+    
+    // Determine destination directory based on classification rules
+    classification_category_identifier destination_category =
+        determine_classification_category(file_extension_identifier, mapping_registry);
+    
+    // Create file classification entry with calculated processing priority
+    file_classification_entry current_entry;
+    current_entry.filename_identifier = current_filename;
+    current_entry.file_size_bytes = 0;
+    current_entry.category_identifier = destination_category;
+    current_entry.processing_priority = calculate_processing_priority(destination_category);
+    
+    return current_entry;
+}
+
+/**
+ * filename_storage_arena - Bump allocator owning all filename bytes of a run
+ * Bytes are carved from large blocks that are never moved or freed before the
+ * arena itself, so string_views handed out stay valid for the whole run and
+ * storing a name costs one copy instead of one heap allocation per file.
+ * Not thread-safe: each producer of entries owns its own arena
+ */
+class filename_storage_arena {
+public:
+    explicit filename_storage_arena(size_t initial_block_size = FILENAME_ARENA_BLOCK_SIZE)
+        : next_block_size(initial_block_size) {}
+
+    // Copy bytes into the arena and return a stable view of the copy
+    std::string_view store_bytes(std::string_view source_bytes) {
+        if (source_bytes.size() > block_remaining) allocate_block(source_bytes.size());
+        std::memcpy(block_cursor, source_bytes.data(), source_bytes.size());
+        std::string_view stored_bytes(block_cursor, source_bytes.size());
+        block_cursor += source_bytes.size();
+        block_remaining -= source_bytes.size();
+        bytes_stored += source_bytes.size();
+        return stored_bytes;
+    }
+
+    // Copy text plus a terminating NUL so the returned view can be passed to system calls
+    std::string_view store_c_string(std::string_view source_text) {
+        if (source_text.size() + 1 > block_remaining) allocate_block(source_text.size() + 1);
+        std::string_view stored_text = store_bytes(source_text);
+        *block_cursor++ = '\0';
+        block_remaining--;
+        bytes_stored++;
+        return stored_text;
+    }
+
+    // Size future blocks so an expected total fits in few allocations
+    void reserve_bytes(size_t expected_total_bytes) {
+        if (expected_total_bytes <= bytes_stored + block_remaining) return;
+        size_t missing_bytes = expected_total_bytes - bytes_stored - block_remaining;
+        next_block_size = std::min(std::max(next_block_size, missing_bytes), FILENAME_ARENA_MAXIMUM_BLOCK_SIZE);
+    }
+
+    size_t stored_byte_count() const { return bytes_stored; }
+    size_t reserved_byte_count() const { return bytes_reserved; }
+    size_t block_count() const { return storage_blocks.size(); }
+
+private:
+    void allocate_block(size_t minimum_size) {
+        size_t block_size = std::max(next_block_size, minimum_size);
+        storage_blocks.emplace_back(new char[block_size]);
+        block_cursor = storage_blocks.back().get();
+        block_remaining = block_size;
+        bytes_reserved += block_size;
+    }
+
+    std::vector<std::unique_ptr<char[]>> storage_blocks;  // Owned blocks, oldest first
+    char* block_cursor = nullptr;             // Next free byte in the newest block
+    size_t block_remaining = 0;               // Free bytes left in the newest block
+    size_t next_block_size;                   // Size of the next block to allocate
+    size_t bytes_stored = 0;                  // Bytes handed out so far
+    size_t bytes_reserved = 0;                // Bytes allocated across all blocks
+};
+
+#if defined(ARTLEST_IO_URING_AVAILABLE)
+/**
+ * io_uring_submission_ring - Minimal io_uring instance driven through raw system calls
+ * Maps the submission and completion rings shared with the kernel and runs
+ * batches of operations with one io_uring_enter per window of up to
+ * IO_URING_QUEUE_DEPTH requests, so thousands of metadata operations are in
+ * flight per thread without one system call each. Not thread-safe: every
+ * walker worker and every executor owns its own ring
+ */
+class io_uring_submission_ring {
+public:
+    io_uring_submission_ring() = default;
+    io_uring_submission_ring(const io_uring_submission_ring&) = delete;
+    io_uring_submission_ring& operator=(const io_uring_submission_ring&) = delete;
+
+    ~io_uring_submission_ring();
+
+    // Create the ring; returns false when the kernel or sandbox does not allow io_uring
+    bool initialize_ring(unsigned queue_depth);
+
+    // Ask the kernel whether an opcode is implemented (operations were added across kernel releases)
+    bool supports_operation(unsigned operation_code) const;
+
+    /**
+     * execute_operation_batch - Runs operation_count operations in submission windows
+     * prepare_operation(index, sqe) fills one request; complete_operation(index, result)
+     * receives the kernel result (negative errno on failure) in completion order.
+     * Returns false when io_uring_enter fails: every request the kernel had
+     * accepted is reaped first, operations never submitted complete with
+     * -ECANCELED, and the ring must not be used again
+     */
+    template <typename prepare_function, typename complete_function>
+    bool execute_operation_batch(size_t operation_count, prepare_function prepare_operation,
+                                 complete_function complete_operation) {
+        for (size_t window_start = 0; window_start < operation_count; window_start += submission_capacity) {
+            size_t window_end = std::min(operation_count, window_start + submission_capacity);
+            for (size_t operation_index = window_start; operation_index < window_end; ++operation_index) {
+                io_uring_sqe* submission_entry = &submission_entries[local_submission_tail & submission_mask];
+                std::memset(submission_entry, 0, sizeof(*submission_entry));
+                prepare_operation(operation_index, submission_entry);
+                submission_entry->user_data = operation_index;
+                submission_index_array[local_submission_tail & submission_mask] = local_submission_tail & submission_mask;
+                local_submission_tail++;
+            }
+            __atomic_store_n(submission_tail, local_submission_tail, __ATOMIC_RELEASE);
+            
+            // Submit the window and reap until every request of it has completed
+            unsigned pending_submissions = static_cast<unsigned>(window_end - window_start);
+            size_t outstanding_completions = pending_submissions;
+            while (outstanding_completions > 0) {
+                long enter_result = syscall(__NR_io_uring_enter, ring_descriptor, pending_submissions, 1,
+                                            IORING_ENTER_GETEVENTS, nullptr, 0);
+                if (enter_result < 0) {
+                    if (errno == EINTR) continue;
+                    drain_accepted_operations(outstanding_completions - pending_submissions, complete_operation);
+                    for (size_t operation_index = window_end - pending_submissions; operation_index < operation_count; ++operation_index) {
+                        complete_operation(operation_index, -ECANCELED);  // Never reached the kernel
+                    }
+                    return false;
+                }
+                pending_submissions -= static_cast<unsigned>(std::min<long>(enter_result, pending_submissions));
+                outstanding_completions -= reap_completions(complete_operation);
+            }
+        }
+        return true;
+    }
+
+private:
+    // Hand every posted completion to complete_operation; returns how many were reaped
+    template <typename complete_function>
+    size_t reap_completions(complete_function& complete_operation) {
+        unsigned head_position = *completion_head;
+        unsigned tail_position = __atomic_load_n(completion_tail, __ATOMIC_ACQUIRE);
+        size_t reaped_count = 0;
+        for (; head_position != tail_position; ++head_position, ++reaped_count) {
+            const io_uring_cqe& completion_entry = completion_entries[head_position & completion_mask];
+            complete_operation(static_cast<size_t>(completion_entry.user_data), completion_entry.res);
+        }
+        __atomic_store_n(completion_head, head_position, __ATOMIC_RELEASE);
+        return reaped_count;
+    }
+
+    // Wait for requests already owned by the kernel so none completes after the caller moves on
+    template <typename complete_function>
+    void drain_accepted_operations(size_t in_flight_count, complete_function& complete_operation) {
+        while (in_flight_count > 0) {
+            in_flight_count -= std::min(in_flight_count, reap_completions(complete_operation));
+            if (in_flight_count == 0) break;
+            if (syscall(__NR_io_uring_enter, ring_descriptor, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0) < 0 && errno != EINTR) {
+                return;  // Cannot wait any longer; the remaining requests stay unreported
+            }
+        }
+    }
+
+    void* map_ring_region(size_t region_size, off_t region_offset);
+
+    int ring_descriptor = -1;                 // io_uring instance descriptor
+    void* submission_ring_memory = nullptr;   // Mapped submission ring
+    void* completion_ring_memory = nullptr;   // Mapped completion ring (may alias the submission ring)
+    io_uring_sqe* submission_entries = nullptr;  // Mapped submission entry array
+    size_t submission_ring_size = 0;
+    size_t completion_ring_size = 0;
+    size_t submission_entries_size = 0;
+    unsigned* submission_tail = nullptr;
+    unsigned* submission_index_array = nullptr;
+    unsigned submission_mask = 0;
+    unsigned submission_capacity = 0;
+    unsigned local_submission_tail = 0;       // Tail position not yet published to the kernel
+    unsigned* completion_head = nullptr;
+    unsigned* completion_tail = nullptr;
+    unsigned completion_mask = 0;
+    io_uring_cqe* completion_entries = nullptr;
+};
+
+/**
+ * create_io_uring_instance - Builds a ring supporting the given opcodes, or nullptr
+ * Callers fall back to their synchronous path when nullptr is returned
+ */
+std::unique_ptr<io_uring_submission_ring> create_io_uring_instance(std::initializer_list<unsigned> required_operations);
+#endif
+
+/**
+ * adaptive_concurrency_snapshot - Observed state of one adaptive concurrency limit
+ */
+struct adaptive_concurrency_snapshot {
+    uint64_t device_identifier = 0;           // Device the limit governs
+    size_t current_limit = 0;                 // In-flight operations admitted at the end of the run
+    size_t peak_limit = 0;                    // Highest limit reached
+    size_t decrease_count = 0;                // Multiplicative cuts after latency rose
+    size_t sampled_operation_count = 0;       // Completed operations that reported latency
+    double baseline_latency_seconds = 0.0;    // Lowest smoothed per-unit latency (drifting upward)
+};
+
+/**
+ * adaptive_concurrency_limiter - AIMD bound on in-flight I/O operations of one device
+ * Every completed operation reports its latency. Once per round (one limit's
+ * worth of completions) the smoothed latency is compared with the baseline,
+ * the lowest smoothed latency seen so far: close to it the limit grows by
+ * one, well above it the device is queueing and the limit is cut
+ * multiplicatively. The baseline drifts upward a little each round so a
+ * device that became permanently slower is re-learned instead of starved
+ */
+class adaptive_concurrency_limiter {
+public:
+    explicit adaptive_concurrency_limiter(uint64_t device_identifier, size_t maximum_limit)
+        : governed_device_identifier(device_identifier),
+          maximum_concurrency_limit(static_cast<double>(std::max<size_t>(1, maximum_limit))),
+          current_concurrency_limit(std::min(static_cast<double>(ADAPTIVE_INITIAL_CONCURRENCY), maximum_concurrency_limit)),
+          peak_concurrency_limit(current_concurrency_limit) {}
+
+    adaptive_concurrency_limiter(const adaptive_concurrency_limiter&) = delete;
+    adaptive_concurrency_limiter& operator=(const adaptive_concurrency_limiter&) = delete;
+
+    /**
+     * operation_permit - One admitted operation; reports its latency when destroyed
+     * A null limiter admits immediately and measures nothing. Latency is divided
+     * by the operation's units (e.g. entries of a listed directory) so large and
+     * small operations feed the same signal
+     */
+    class operation_permit {
+    public:
+        explicit operation_permit(adaptive_concurrency_limiter* limiter) : owning_limiter(limiter) {
+            if (owning_limiter == nullptr) return;
+            owning_limiter->acquire_slot();
+            operation_start = std::chrono::steady_clock::now();
+        }
+        ~operation_permit() { complete(); }
+        operation_permit(const operation_permit&) = delete;
+        operation_permit& operator=(const operation_permit&) = delete;
+
+        void set_operation_units(size_t unit_count) { operation_units = std::max<size_t>(1, unit_count); }
+
+        // Report the latency now instead of at destruction (e.g. before handing results on)
+        void complete() {
+            if (owning_limiter == nullptr) return;
+            double elapsed_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - operation_start).count();
+            owning_limiter->release_slot(elapsed_seconds / static_cast<double>(operation_units), true);
+            owning_limiter = nullptr;
+        }
+
+        // Give the slot back without a latency sample (the operation never happened)
+        void abandon() {
+            if (owning_limiter == nullptr) return;
+            owning_limiter->release_slot(0.0, false);
+            owning_limiter = nullptr;
+        }
+
+    private:
+        adaptive_concurrency_limiter* owning_limiter;
+        std::chrono::steady_clock::time_point operation_start;
+        size_t operation_units = 1;
+    };
+
+    adaptive_concurrency_snapshot snapshot() const {
+        std::lock_guard<std::mutex> limiter_guard(limiter_lock);
+        adaptive_concurrency_snapshot limit_snapshot;
+        limit_snapshot.device_identifier = governed_device_identifier;
+        limit_snapshot.current_limit = static_cast<size_t>(current_concurrency_limit);
+        limit_snapshot.peak_limit = static_cast<size_t>(peak_concurrency_limit);
+        limit_snapshot.decrease_count = limit_decrease_count;
+        limit_snapshot.sampled_operation_count = sampled_operation_count;
+        limit_snapshot.baseline_latency_seconds = baseline_latency_seconds;
+        return limit_snapshot;
+    }
+
+private:
+    void acquire_slot() {
+        std::unique_lock<std::mutex> limiter_guard(limiter_lock);
+        admission_signal.wait(limiter_guard, [this] {
+            return static_cast<double>(in_flight_operation_count) < std::floor(current_concurrency_limit);
+        });
+        in_flight_operation_count++;
+    }
+
+    void release_slot(double latency_seconds, bool latency_sampled) {
+        bool limit_increased = false;
+        {
+            std::lock_guard<std::mutex> limiter_guard(limiter_lock);
+            in_flight_operation_count--;
+            if (latency_sampled) {
+                smoothed_latency_seconds = sampled_operation_count == 0
+                                               ? latency_seconds
+                                               : smoothed_latency_seconds + ADAPTIVE_LATENCY_SMOOTHING * (latency_seconds - smoothed_latency_seconds);
+                sampled_operation_count++;
+                if (++round_completion_count >= static_cast<size_t>(current_concurrency_limit)) {
+                    round_completion_count = 0;
+                    baseline_latency_seconds = baseline_latency_seconds == 0.0
+                                                   ? smoothed_latency_seconds
+                                                   : std::min(smoothed_latency_seconds, baseline_latency_seconds * (1.0 + ADAPTIVE_BASELINE_DRIFT));
+                    if (smoothed_latency_seconds <= baseline_latency_seconds * ADAPTIVE_LATENCY_TOLERANCE) {
+                        double increased_limit = std::min(maximum_concurrency_limit, current_concurrency_limit + 1.0);
+                        limit_increased = increased_limit > current_concurrency_limit;
+                        current_concurrency_limit = increased_limit;
+                        peak_concurrency_limit = std::max(peak_concurrency_limit, current_concurrency_limit);
+                    } else {
+                        current_concurrency_limit = std::max(1.0, std::floor(current_concurrency_limit * ADAPTIVE_DECREASE_FACTOR));
+                        limit_decrease_count++;
+                    }
+                }
+            }
+        }
+        if (limit_increased) {
+            admission_signal.notify_all();
+        } else {
+            admission_signal.notify_one();
+        }
+    }
+
+    uint64_t governed_device_identifier;      // Device the limit governs (diagnostics only)
+    double maximum_concurrency_limit;         // Upper bound (worker threads available)
+    double current_concurrency_limit;         // Operations admitted concurrently
+    double peak_concurrency_limit;            // Highest limit reached
+    double smoothed_latency_seconds = 0.0;    // EWMA of per-unit latency
+    double baseline_latency_seconds = 0.0;    // Lowest smoothed latency, drifting upward
+    size_t in_flight_operation_count = 0;     // Admitted operations not yet released
+    size_t round_completion_count = 0;        // Completions since the last adjustment
+    size_t sampled_operation_count = 0;       // Completions that reported latency
+    size_t limit_decrease_count = 0;          // Multiplicative cuts so far
+    mutable std::mutex limiter_lock;          // Guards every field above
+    std::condition_variable admission_signal; // Wakes operations waiting for a slot
+};
+
+/**
+ * file_move_statistics - Outcome counters of the file moving executor
+ */
+struct file_move_statistics {
+    size_t files_renamed = 0;                 // Same-device moves completed with one rename
+    size_t files_copied = 0;                  // Cross-device moves completed by copy and unlink
+    size_t collision_renames = 0;             // Moves that needed an alternative destination name
+    size_t failed_moves = 0;                  // Files left in place because a move failed
+    unsigned long long bytes_copied = 0;      // Bytes copied by the cross-device fallback
+};
+
+/**
+ * build_collision_candidate_name - Derives "stem (N).ext" for an occupied destination name
+ */
+void build_collision_candidate_name(std::string_view original_filename, int attempt_number, std::string& candidate_name);
+
+/**
+ * file_move_executor - Moves classified files into per-category directories
+ * Category directories are created and opened once per run and kept as cached
+ * descriptors; entries are processed in runs sharing a source directory so
+ * each run opens its source once and then issues one renameat per file.
+ * Existing destination files are never replaced: collisions get a numbered
+ * alternative name. Cross-device moves fall back to an in-kernel copy
+ * (copy_file_range, then sendfile, then read/write) followed by unlink.
+ * With the io_uring backend enabled each run is first submitted as one batch
+ * of RENAME_NOREPLACE renames; only entries whose rename fails (collision,
+ * cross-device, unsupported flag) take the synchronous path above, starting
+ * at the first numbered name after a collision. Categories on a device known
+ * to reject the flag skip the ring.
+ * With adaptive concurrency enabled (and no io_uring ring), large batches are
+ * split into same-directory chunks moved by a pool of worker threads started
+ * once with the limits, each move admitted by the AIMD limit of its
+ * destination device.
+ * One executor is driven by one thread
+ */
+class file_move_executor {
+public:
+    file_move_executor();
+    ~file_move_executor();
+
+    file_move_executor(const file_move_executor&) = delete;
+    file_move_executor& operator=(const file_move_executor&) = delete;
+
+    /**
+     * prepare_destination_directories - Creates and opens every category directory once
+     * Returns false when any directory is unusable, after printing the reason
+     * or, when error_message is given, storing it there instead
+     */
+    bool prepare_destination_directories(const std::string& destination_root_path, std::string* error_message = nullptr);
+
+    // Count move failures without printing them (callers read move_statistics instead)
+    void suppress_failure_reports() { failure_reports_enabled = false; }
+
+    /**
+     * enable_io_uring_backend - Switches renames to batched io_uring submission
+     * Returns false when io_uring or IORING_OP_RENAMEAT is unavailable; the
+     * executor then keeps issuing synchronous renames
+     */
+    bool enable_io_uring_backend();
+
+    /**
+     * enable_adaptive_concurrency - Moves large batches concurrently under per-device limits
+     * Category directories sharing a device share one limit. Call after
+     * prepare_destination_directories; returns false when only the portable
+     * single-threaded path exists
+     */
+    bool enable_adaptive_concurrency();
+
+    // Whether renames still go through the io_uring ring (false once it broke or when never enabled)
+    bool io_uring_backend_active() const {
+#if defined(ARTLEST_IO_URING_AVAILABLE)
+        return rename_ring != nullptr;
+#else
+        return false;
+#endif
+    }
+
+    // Final state of every destination device limit (empty when adaptive concurrency is off)
+    std::vector<adaptive_concurrency_snapshot> adaptive_concurrency_snapshots() const;
+
+    /**
+     * execute_move_batch - Moves a run of entries, reusing source descriptors
+     * Consecutive entries from the same source directory share one descriptor
+     */
+    void execute_move_batch(const file_classification_entry* entry_collection, size_t entry_count);
+
+    const file_move_statistics& move_statistics() const { return executor_statistics; }
+
+    // Totals as of the last completed batch; safe to read from any thread
+    file_move_statistics published_move_statistics() const {
+        file_move_statistics published_statistics;
+        published_statistics.files_renamed = published_files_renamed.load(std::memory_order_relaxed);
+        published_statistics.files_copied = published_files_copied.load(std::memory_order_relaxed);
+        published_statistics.collision_renames = published_collision_renames.load(std::memory_order_relaxed);
+        published_statistics.failed_moves = published_failed_moves.load(std::memory_order_relaxed);
+        published_statistics.bytes_copied = published_bytes_copied.load(std::memory_order_relaxed);
+        return published_statistics;
+    }
+
+private:
+#if defined(ARTLEST_POSIX_FILE_OPERATIONS)
+    void execute_move_batch_concurrently(const file_classification_entry* entry_collection, size_t entry_count);
+    void execute_move_worker_loop();
+    void move_pending_chunks();
+    void relocate_directory_run(int source_directory_descriptor, const file_classification_entry* run_entries, size_t run_length);
+    void relocate_entry(int source_directory_descriptor, const file_classification_entry& current_entry,
+                        file_move_statistics& outcome_statistics, int first_attempt_number = 0);
+    int rename_without_replacement(int source_directory_descriptor, const char* source_filename,
+                                   classification_category_identifier destination_category, const char* destination_filename);
+    void mark_noreplace_unsupported(uint64_t device_identifier);
+    int copy_across_devices(int source_directory_descriptor, const char* source_filename,
+                            int destination_directory_descriptor, const char* destination_filename,
+                            file_move_statistics& outcome_statistics);
+    static int copy_descriptor_contents(int source_descriptor, int destination_descriptor, unsigned long long expected_bytes);
+
+    uint64_t category_device_identifiers[CLASSIFICATION_CATEGORY_COUNT] = {};  // Device of each category directory
+    std::atomic<bool> category_noreplace_unsupported[CLASSIFICATION_CATEGORY_COUNT];  // Device rejected RENAME_NOREPLACE
+#if defined(ARTLEST_IO_URING_AVAILABLE)
+    std::unique_ptr<io_uring_submission_ring> rename_ring;  // Batched rename submission (null when disabled)
+#endif
+    std::vector<std::thread> move_worker_threads;           // Started by enable_adaptive_concurrency, joined on destruction
+    std::mutex move_pool_lock;                              // Guards the slot and busy counts and the stop flag
+    std::condition_variable move_pool_signal;               // Wakes workers for a batch or shutdown
+    std::condition_variable move_pool_idle_signal;          // Wakes the batch caller once every worker is done
+    size_t open_move_worker_slots = 0;                      // Workers still allowed to join the current batch
+    size_t busy_move_worker_count = 0;                      // Workers moving chunks of the current batch
+    bool move_pool_stopping = false;
+    const file_classification_entry* pending_move_entries = nullptr;  // Current batch, valid while it runs
+    std::vector<std::pair<size_t, size_t>> pending_move_chunks;       // Entry ranges of the current batch
+    std::atomic<size_t> next_move_chunk_index{0};                     // Next chunk to claim
+#else
+    void relocate_entry_portably(const file_classification_entry& current_entry);
+#endif
+
+    void report_move_failure(const file_classification_entry& current_entry, int error_code);
+    static void report_setup_failure(const std::string& failure_description, std::string* error_message);
+    void publish_move_statistics();
+
+    int category_directory_descriptors[CLASSIFICATION_CATEGORY_COUNT];      // Cached destination descriptors
+    std::string category_directory_paths[CLASSIFICATION_CATEGORY_COUNT];    // Destination paths for diagnostics
+    file_move_statistics executor_statistics;                               // Outcome counters
+    std::atomic<size_t> published_files_renamed{0};                         // executor_statistics copies for live export
+    std::atomic<size_t> published_files_copied{0};
+    std::atomic<size_t> published_collision_renames{0};
+    std::atomic<size_t> published_failed_moves{0};
+    std::atomic<unsigned long long> published_bytes_copied{0};
+    std::mutex statistics_lock;                                             // Guards counters while move threads run
+    std::vector<std::unique_ptr<adaptive_concurrency_limiter>> device_concurrency_limiters;  // One per destination device
+    adaptive_concurrency_limiter* category_concurrency_limiters[CLASSIFICATION_CATEGORY_COUNT] = {};  // Limit of each category's device
+    bool failure_reports_enabled = true;                                    // Print the first move failures to stderr
+};
+
+/**
+ * rule_configuration_matcher - User rules compiled into constant-cost matchers
+ * A rule file holds one rule per line, "<kind> <argument> <CATEGORY>":
+ *   extension <ext>      name ends in .<ext> (case-insensitive)
+ *   glob <pattern>       whole name matches; '*' any run, '?' one character
+ *   size-above <bytes>   file is larger than bytes (K, M, G suffixes allowed)
+ *   size-below <bytes>   file is smaller than bytes
+ *   prefix <directory>   file lies in directory or below it
+ * Blank lines and '#' comments are ignored. The earliest matching rule wins and
+ * entries matching no rule keep their built-in classification. Extensions and
+ * globs are compiled into one DFA over the reversed, lowercased name; prefixes
+ * into a hash of directory paths probed once per ancestor; size thresholds into
+ * sorted arrays with running minima. Matching a file therefore costs one pass
+ * over its name plus two binary searches, whatever the number of rules
+ */
+class rule_configuration_matcher {
+public:
+    static constexpr uint32_t NO_RULE_MATCH = UINT32_MAX;
+
+    // Parse and compile a rule file; error_message names the offending line
+    bool load_rule_file(const std::string& rule_file_path, std::string& error_message);
+
+    bool has_rules() const { return !rule_categories.empty(); }
+    bool requires_file_sizes() const { return !size_above_rules.empty() || !size_below_rules.empty(); }
+
+    // Earliest prefix rule covering the directory; evaluated once per directory batch
+    uint32_t match_directory_prefix(std::string_view directory_path) const;
+
+    // Resolve one entry; returns false when no rule applies
+    bool match_entry(std::string_view filename, uint64_t file_size_bytes, uint32_t directory_rule_index,
+                     classification_category_identifier& category_identifier) const {
+        uint32_t matched_rule = directory_rule_index;
+        
+        // Walk the DFA from the end of the name until it absorbs (dead or accepting forever)
+        if (!automaton_accepting_rules.empty()) {
+            uint32_t automaton_state = AUTOMATON_START_STATE;
+            for (size_t character_index = filename.size(); character_index-- > 0 && !automaton_absorbing_states[automaton_state];) {
+                automaton_state = automaton_transitions[automaton_state * byte_class_count +
+                                                        byte_class_map[static_cast<unsigned char>(filename[character_index])]];
+            }
+            matched_rule = std::min(matched_rule, automaton_accepting_rules[automaton_state]);
+        }
+        
+        // Thresholds below the size (size-above) form a prefix; thresholds above it (size-below) a suffix
+        if (!size_above_rules.empty()) {
+            auto first_not_below = std::lower_bound(size_above_rules.begin(), size_above_rules.end(), file_size_bytes,
+                [](const size_threshold_rule& threshold_rule, uint64_t size_value) { return threshold_rule.size_threshold < size_value; });
+            if (first_not_below != size_above_rules.begin()) matched_rule = std::min(matched_rule, std::prev(first_not_below)->earliest_rule_index);
+        }
+        if (!size_below_rules.empty()) {
+            auto first_above = std::upper_bound(size_below_rules.begin(), size_below_rules.end(), file_size_bytes,
+                [](uint64_t size_value, const size_threshold_rule& threshold_rule) { return size_value < threshold_rule.size_threshold; });
+            if (first_above != size_below_rules.end()) matched_rule = std::min(matched_rule, first_above->earliest_rule_index);
+        }
+        
+        if (matched_rule == NO_RULE_MATCH) return false;
+        category_identifier = rule_categories[matched_rule];
+        return true;
+    }
+
+    size_t rule_count() const { return rule_categories.size(); }
+    size_t automaton_state_count() const { return automaton_accepting_rules.size(); }
+
+    // One-line inventory of the loaded rules
+    std::string describe_rules() const;
+
+private:
+    static constexpr uint32_t AUTOMATON_DEAD_STATE = 0;
+    static constexpr uint32_t AUTOMATON_START_STATE = 1;
+    static constexpr size_t MAXIMUM_AUTOMATON_STATES = 1 << 16;
+
+    struct size_threshold_rule {
+        uint64_t size_threshold;              // Bytes compared against the file size
+        uint32_t earliest_rule_index;         // Rule index, then running minimum after preparation
+    };
+
+    static bool parse_size_threshold(const std::string& size_argument, uint64_t& size_threshold);
+    void prepare_size_thresholds();
+    bool compile_name_automaton(const std::vector<std::pair<std::string, uint32_t>>& name_patterns, std::string& error_message);
+
+    std::vector<classification_category_identifier> rule_categories;  // Category per rule index (file order)
+    uint16_t byte_class_map[256] = {};            // Byte (case-folded) to automaton input class
+    uint32_t byte_class_count = 0;                // Distinct literal bytes plus the catch-all class
+    std::vector<uint32_t> automaton_transitions;  // state * byte_class_count + class -> next state
+    std::vector<uint32_t> automaton_accepting_rules;  // Earliest accepted rule per state (NO_RULE_MATCH if none)
+    std::vector<uint8_t> automaton_absorbing_states;  // States every byte maps back to
+    std::unordered_map<std::string, uint32_t> prefix_rule_indices;  // Directory path to earliest prefix rule
+    std::vector<size_threshold_rule> size_above_rules;  // Ascending thresholds, prefix minima
+    std::vector<size_threshold_rule> size_below_rules;  // Ascending thresholds, suffix minima
+    size_t extension_rule_count = 0;
+    size_t glob_rule_count = 0;
+    size_t prefix_rule_count = 0;
+};
+
+/**
+ * apply_rule_configuration_to_entries - Overrides built-in results with user rules
+ * The prefix lookup is done once because every entry shares source_directory_path;
+ * matched entries are flagged rule_classified so content sniffing leaves them alone
+ */
+void apply_rule_configuration_to_entries(const rule_configuration_matcher& rule_matcher, std::string_view source_directory_path,
+                                         file_classification_entry* entry_collection, size_t entry_count);
+
+/**
+ * sort_entries_by_processing_priority - Stable O(n) bucket sort over priority levels
+ * Priorities only take MAXIMUM_PRIORITY_LEVEL distinct values, so one counting
+ * pass, a prefix sum and one scatter pass order the entries while preserving
+ * their arrival order within each level, making the output reproducible
+ */
+void sort_entries_by_processing_priority(std::vector<file_classification_entry>& processed_file_results);
+
+#if defined(ARTLEST_COROUTINE_API_AVAILABLE)
+/**
+ * embedded_file_sorter - C++20 coroutine API for hosting the sorter inside another program
+ * classify_batch is pure computation over the constexpr extension table (plus
+ * optional rules) and completes without suspending. move suspends: the batch
+ * is copied to the sorter's I/O thread, which drives one file_move_executor
+ * directory by directory (priority order within each), and the awaiting
+ * coroutine is handed back through the host's resume callback, so it continues
+ * on the host's event loop and no host thread blocks on file system calls. Nothing is printed; outcomes are returned.
+ * Destroy the sorter only after every move has been resumed
+ */
+class embedded_file_sorter {
+public:
+    using resume_callback = std::function<void(std::coroutine_handle<>)>;
+
+    // Awaitable of classify_batch; the result is ready before the first co_await
+    class classify_awaitable {
+    public:
+        explicit classify_awaitable(std::vector<file_classification_entry>&& classified_entries)
+            : classification_results(std::move(classified_entries)) {}
+        bool await_ready() const noexcept { return true; }
+        void await_suspend(std::coroutine_handle<>) const noexcept {}
+        std::vector<file_classification_entry> await_resume() { return std::move(classification_results); }
+
+    private:
+        std::vector<file_classification_entry> classification_results;
+    };
+
+    // Awaitable of move; lives in the awaiting coroutine's frame while the I/O thread works
+    class move_awaitable {
+    public:
+        move_awaitable(embedded_file_sorter& owning_sorter, std::span<const file_classification_entry> requested_entries)
+            : sorter(owning_sorter), entries(requested_entries) {}
+        bool await_ready() const noexcept { return entries.empty(); }
+        void await_suspend(std::coroutine_handle<> awaiting_coroutine) { sorter.submit_move(*this, awaiting_coroutine); }
+        file_move_statistics await_resume() const noexcept { return move_outcome; }
+
+    private:
+        friend class embedded_file_sorter;
+        embedded_file_sorter& sorter;
+        std::span<const file_classification_entry> entries;
+        file_move_statistics move_outcome;    // This batch's share of the executor counters
+    };
+
+    explicit embedded_file_sorter(resume_callback resume_on_event_loop);
+    ~embedded_file_sorter();
+
+    embedded_file_sorter(const embedded_file_sorter&) = delete;
+    embedded_file_sorter& operator=(const embedded_file_sorter&) = delete;
+
+    // Create and open the category directories; one-time setup, call before the event loop runs
+    bool open_destination(const std::string& destination_root_path, std::string& error_message);
+
+    // Load user rules, replacing any loaded before; on failure the previous rules stay in effect.
+    // Size rules are rejected because classify_batch never stats files
+    bool load_rules(const std::string& rule_file_path, std::string& error_message);
+
+    /**
+     * classify_batch - Classifies names of one source directory
+     * Entries borrow the caller's name and directory storage; move copies
+     * what it needs, so the inputs only have to outlive the co_await. The
+     * directory is required because move resolves every name against it
+     */
+    classify_awaitable classify_batch(std::span<const std::string_view> filenames, std::string_view source_directory_path) const;
+
+    // Move classified entries (any directories) into the destination, grouped by source directory
+    move_awaitable move(std::span<const file_classification_entry> entries) { return move_awaitable(*this, entries); }
+
+private:
+    struct queued_move {
+        move_awaitable* awaiting_move;        // Receives the outcome
+        std::coroutine_handle<> awaiting_coroutine;  // Resumed through the host callback
+    };
+
+    void submit_move(move_awaitable& awaiting_move, std::coroutine_handle<> awaiting_coroutine);
+    void execute_io_loop();
+    void execute_queued_move(move_awaitable& awaiting_move);
+
+    resume_callback resume_awaiting_coroutine;  // Host hook that continues a coroutine on its event loop
+    rule_configuration_matcher rule_matcher;  // Optional user rules
+    file_move_executor move_executor;         // Driven by io_thread only, after setup
+    bool destination_ready = false;           // open_destination succeeded
+    std::deque<queued_move> pending_moves;    // Guarded by job_lock
+    bool stop_requested = false;              // Guarded by job_lock
+    std::mutex job_lock;
+    std::condition_variable job_signal;       // Wakes the I/O thread for new moves and shutdown
+    std::thread io_thread;                    // Declared last: starts after every other member exists
+};
+#endif
+
+#endif